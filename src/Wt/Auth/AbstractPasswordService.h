@@ -12,6 +12,8 @@
 
 #include <Wt/Auth/User.h>
 
+#include <functional>
+
 namespace Wt {
   namespace Auth {
 
@@ -171,6 +173,31 @@ public:
   virtual PasswordResult verifyPassword(const User& user,
 					const WT_USTRING& password) const = 0;
 
+  /*! \brief Verifies a password for a given user, without blocking.
+   *
+   * This verifies the password like verifyPassword(), but the result
+   * is passed to the \p callback, which is called from within the
+   * current session. This allows an implementation to compute the
+   * (expensive) password hash in another thread.
+   *
+   * The default implementation calls verifyPassword() and passes the
+   * result to the \p callback before returning.
+   *
+   * \sa PasswordService::setHashingPool()
+   */
+  virtual void verifyPasswordAsync
+    (const User& user, const WT_USTRING& password,
+     const std::function<void (PasswordResult)>& callback) const;
+
+  /*! \brief Returns whether passwords are verified asynchronously.
+   *
+   * Returns whether verifyPasswordAsync() may return before calling
+   * the callback, when called from within the current session.
+   *
+   * The default implementation returns \c false.
+   */
+  virtual bool asyncVerificationEnabled() const;
+
   /*! \brief Sets a new password for the given user.
    *
    * This stores a new password for the user in the database. 
@@ -7,6 +7,7 @@
 #ifndef WT_AUTH_AUTH_MODEL_H_
 #define WT_AUTH_AUTH_MODEL_H_
 
+#include <Wt/Auth/AbstractPasswordService.h>
 #include <Wt/Auth/AuthService.h>
 #include <Wt/Auth/FormBaseModel.h>
 #include <Wt/Auth/Identity.h>
@@ -109,6 +110,28 @@ public:
    */
   virtual bool login(Login& login);
 
+#ifndef WT_TARGET_JAVA
+  /*! \brief Validates the model and logs the user in, without blocking.
+   *
+   * This is an alternative for validate() followed by login(), which
+   * verifies the password using
+   * AbstractPasswordService::verifyPasswordAsync(). The \p callback is
+   * called from within the session with whether the user could be
+   * logged in, possibly after this method returned. The \p login
+   * object must remain valid until then.
+   *
+   * When the password service does not verify passwords
+   * asynchronously (see
+   * AbstractPasswordService::asyncVerificationEnabled()), this calls
+   * validate() and login(). Otherwise, the fields other than the
+   * password are validated using validateField().
+   *
+   * \sa PasswordService::setHashingPool()
+   */
+  virtual void loginAsync(Login& login,
+			  const std::function<void (bool)>& callback);
+#endif // WT_TARGET_JAVA
+
   /*! \brief Logs the user out.
    *
    * This also removes the remember-me cookie for the user.
@@ -139,6 +162,8 @@ public:
 
 private:
   int throttlingDelay_;
+
+  bool processPasswordResult(const User& user, PasswordResult result);
 };
 
   }
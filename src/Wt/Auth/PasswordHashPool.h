@@ -0,0 +1,85 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2011 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_AUTH_PASSWORD_HASH_POOL_H_
+#define WT_AUTH_PASSWORD_HASH_POOL_H_
+
+#include <Wt/WConfig.h>
+#include <Wt/Auth/PasswordService.h>
+
+#ifdef WT_THREADED
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Wt {
+  namespace Auth {
+
+/*
+ * A fixed number of threads that run password hashing jobs, so that
+ * these do not occupy the threads of the server's I/O service.
+ *
+ * The queue of waiting jobs is bounded: submit() refuses a job when it
+ * is full. Queued jobs are still run when the pool is destroyed.
+ */
+class WT_API PasswordHashPool
+{
+public:
+  PasswordHashPool(int threadCount, std::size_t maximumQueueSize);
+  ~PasswordHashPool();
+
+  // returns false if the queue is full
+  bool submit(const std::function<void ()>& job);
+
+  PasswordService::HashingStatistics statistics() const;
+
+private:
+  typedef std::chrono::steady_clock::time_point Time;
+
+  struct Job {
+    std::function<void ()> function;
+    Time queued;
+  };
+
+  std::size_t maximumQueueSize_;
+  std::vector<std::thread> threads_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable jobAvailable_;
+  std::deque<Job> queue_;
+  bool stopping_;
+
+  std::size_t running_, completed_, rejected_;
+  std::chrono::steady_clock::duration queueTime_, hashTime_;
+
+  PasswordHashPool(const PasswordHashPool&) = delete;
+  PasswordHashPool& operator=(const PasswordHashPool&) = delete;
+
+  void run();
+};
+
+  }
+}
+
+#else // WT_THREADED
+
+namespace Wt {
+  namespace Auth {
+
+// Without threads, password hashing is always done synchronously
+class PasswordHashPool { };
+
+  }
+}
+
+#endif // WT_THREADED
+
+#endif // WT_AUTH_PASSWORD_HASH_POOL_H_
@@ -10,9 +10,13 @@
 #include <Wt/WValidator.h>
 #include <Wt/Auth/AbstractPasswordService.h>
 
+#include <chrono>
+
 namespace Wt {
   namespace Auth {
 
+class PasswordHashPool;
+
 /*! \class PasswordService Wt/Auth/PasswordService.h Wt/Auth/PasswordService.h
  *  \brief Password authentication service
  *
@@ -164,6 +168,83 @@ public:
   virtual PasswordResult verifyPassword(const User& user,
 					const WT_USTRING& password) const override;
 
+  /*! \brief Verifies a password for a given user, without blocking.
+   *
+   * If a hashing pool is configured, the password hash is verified (and
+   * recomputed, if needsUpdate()) by one of its threads, and the result
+   * is processed by posting back to the session using WServer::post().
+   * When the queue of the pool is full, the attempt is refused with
+   * PasswordResult::LoginThrottling.
+   *
+   * Without a hashing pool, or outside of a session that is served by
+   * a WServer, this calls verifyPassword().
+   *
+   * Only one verification per user is in progress at any time: a
+   * concurrent attempt for the same user is refused with
+   * PasswordResult::LoginThrottling, so that the attempt throttling
+   * applies to each guess.
+   *
+   * \sa setHashingPool()
+   */
+  virtual void verifyPasswordAsync
+    (const User& user, const WT_USTRING& password,
+     const std::function<void (PasswordResult)>& callback) const override;
+
+  /*! \brief Returns whether passwords are verified asynchronously.
+   *
+   * Returns \c true when a hashing pool is configured, and this is
+   * called from within a session that is served by a WServer.
+   *
+   * \sa setHashingPool()
+   */
+  virtual bool asyncVerificationEnabled() const override;
+
+  /*! \brief Statistics of the password hashing pool.
+   *
+   * \sa hashingStatistics()
+   */
+  struct HashingStatistics {
+    //! The number of verifications waiting for a thread
+    std::size_t queueDepth;
+    //! The number of verifications that are being computed
+    std::size_t running;
+    //! The number of verifications that were computed
+    std::size_t completed;
+    //! The number of verifications that were refused (queue full)
+    std::size_t rejected;
+    //! The average time a verification waited for a thread
+    std::chrono::microseconds averageQueueTime;
+    //! The average time it took to compute a verification
+    std::chrono::microseconds averageHashTime;
+  };
+
+  /*! \brief Configures a pool of threads for password hashing.
+   *
+   * Computing a password hash (e.g. with BCryptHashFunction) is
+   * deliberately expensive. By default, it is done by
+   * verifyPasswordAsync() in the thread that handles the login event,
+   * so that many concurrent logins may occupy all the threads of the
+   * server. With a hashing pool, this is instead done by at most \p
+   * threadCount threads, with at most \p maximumQueueSize attempts
+   * waiting for a thread.
+   *
+   * A \p threadCount of 0 disables the pool, which is the default.
+   *
+   * This requires a multi-threaded build of %Wt, and should be called
+   * while configuring the service, before it is being used.
+   *
+   * \sa verifyPasswordAsync(), hashingStatistics()
+   */
+  void setHashingPool(int threadCount, std::size_t maximumQueueSize);
+
+  /*! \brief Returns the statistics of the password hashing pool.
+   *
+   * If no hashing pool is configured, all values are 0.
+   *
+   * \sa setHashingPool()
+   */
+  HashingStatistics hashingStatistics() const;
+
   /*! \brief Sets a new password for the given user.
    *
    * This stores a new password for the user in the database.
@@ -193,6 +274,15 @@ private:
   std::unique_ptr<AbstractVerifier> verifier_;
   std::unique_ptr<AbstractStrengthValidator> validator_;
   bool attemptThrottling_;
+  struct PendingVerifications;
+
+  // declared after verifier_: destroying the pool runs the queued jobs
+  std::unique_ptr<PasswordHashPool> hashingPool_;
+  std::shared_ptr<PendingVerifications> pending_;
+
+  static PasswordResult applyVerification(const User& user, bool valid,
+					  const PasswordHash *newHash,
+					  bool attemptThrottling);
 };
 
   }
@@ -24,6 +24,7 @@ class WPainterPath;
   namespace Chart {
 
 class WAxisSliderWidget;
+class WColumnarChartModel;
 
 /*! \class SeriesIterator Wt/Chart/WCartesianChart.h Wt/Chart/WCartesianChart.h
  *  \brief Abstract base class for iterating over series data in a chart.
@@ -88,6 +89,23 @@ public:
 			double stackY, int xRow, int xColumn,
 			int yRow, int yColumn);
 
+  /*! \brief Process a range of values at once.
+   *
+   * This is called, before calling newValue() for each row, when the
+   * model of the series is a WColumnarChartModel and its values are
+   * not affected by stacking. The values are those of the rows
+   * <i>startRow</i> (inclusive) to <i>endRow</i> (exclusive), with the
+   * X values in <i>xColumn</i>, or the row number as X value if
+   * <i>xColumn</i> is -1.
+   *
+   * Returns whether the values were processed. The default
+   * implementation returns \c false, in which case newValue() is
+   * called for each row.
+   */
+  virtual bool newValues(const WDataSeries& series,
+			 const WColumnarChartModel& model, int xColumn,
+			 int startRow, int endRow);
+
   /*! \brief Returns the current X segment.
    */
   int currentXSegment() const { return currentXSegment_; }
@@ -2093,6 +2111,7 @@ private:
                   WPainterPath &result) const;
 
   bool axisSliderWidgetForSeries(WDataSeries *series) const;
+  bool hasDecimatedSeries(int xAxis) const;
 
   class IconWidget : public WPaintedWidget {
   public:
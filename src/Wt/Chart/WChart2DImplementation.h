@@ -29,6 +29,10 @@ public:
   virtual void newValue(const WDataSeries& series, double x, double y,
 			double stackY, int xRow, int xColumn,
 			int yRow, int yColumn) override;
+
+  virtual bool newValues(const WDataSeries& series,
+			 const WColumnarChartModel& model, int xColumn,
+			 int startRow, int endRow) override;
   
   double minimum() { return minimum_; }
   double maximum() { return maximum_; }
@@ -66,6 +66,18 @@ enum class FillRangeType {
   ZeroValue     //!< Fill from the curve to the zero Y value.
 };
 
+/*! \brief Enumeration that specifies how a data series is decimated.
+ *
+ * \sa WDataSeries::setDecimation()
+ *
+ * \ingroup charts
+ */
+enum class DecimationMethod {
+  None,   //!< Render all data points.
+  MinMax, //!< Keep the minimum and maximum point of each pixel column.
+  LargestTriangleThreeBuckets //!< Keep one point per half pixel column (LTTB).
+};
+
 /*! \brief Enumeration type that indicates a chart type for a cartesian
  *         chart.
  *
@@ -0,0 +1,138 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2026 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WCOLUMNAR_CHART_MODEL_H_
+#define WCOLUMNAR_CHART_MODEL_H_
+
+#include "Wt/Chart/WAbstractChartModel.h"
+
+#include <vector>
+
+namespace Wt {
+  namespace Chart {
+
+/*! \class WColumnarChartModel Wt/Chart/WColumnarChartModel.h Wt/Chart/WColumnarChartModel.h
+ *  \brief A chart model that stores its data in columns of doubles.
+ *
+ * Each column is stored in a contiguous <tt>std::vector<double></tt>.
+ * Missing values are represented by NaN. All columns have the same
+ * number of rows.
+ *
+ * In addition to the data, the model keeps the minimum and maximum
+ * value of every block of blockSize() rows in each column. A
+ * WCartesianChart recognizes this model: it computes the automatic
+ * range of its axes from these extremes, instead of reading every
+ * value, and it reads the data directly from the columns while
+ * rendering.
+ *
+ * Use this model instead of a WStandardItemModel (which is wrapped in
+ * a WStandardChartProxyModel) for charts with a large number of data
+ * points, e.g. long time series:
+ * \code
+ * auto model = std::make_shared<Wt::Chart::WColumnarChartModel>();
+ * model->addColumn(times, "Time");
+ * model->addColumn(values, "Value");
+ *
+ * chart->setModel(model);
+ * chart->setXSeriesColumn(0);
+ * chart->addSeries(std::make_unique<Wt::Chart::WDataSeries>(1, Wt::Chart::SeriesType::Line));
+ * \endcode
+ *
+ * \ingroup charts
+ */
+class WT_API WColumnarChartModel : public WAbstractChartModel
+{
+public:
+  /*! \brief The number of rows for which the extremes are kept.
+   */
+  static const int BlockSize = 1024;
+
+  /*! \brief Creates an empty model.
+   */
+  WColumnarChartModel();
+
+  virtual ~WColumnarChartModel();
+
+  /*! \brief Adds a column.
+   *
+   * The number of \p values must be equal to the rowCount(), unless
+   * this is the first column.
+   *
+   * Returns the index of the new column.
+   */
+  int addColumn(std::vector<double> values,
+		const WString& header = WString());
+
+  /*! \brief Replaces the data of a column.
+   *
+   * The number of \p values must be equal to the rowCount(), unless
+   * this is the only column.
+   */
+  void setColumn(int column, std::vector<double> values);
+
+  /*! \brief Returns the data of a column.
+   */
+  const std::vector<double>& column(int column) const;
+
+  /*! \brief Appends a row.
+   *
+   * The row contains one value for each column. This is efficient
+   * for a chart that is updated with new data, such as a time series.
+   */
+  void appendRow(const std::vector<double>& values);
+
+  /*! \brief Removes all rows.
+   *
+   * The columns are kept.
+   */
+  void clearRows();
+
+  /*! \brief Sets the header data of a column.
+   */
+  void setHeaderData(int column, const WString& header);
+
+  /*! \brief Computes the minimum and maximum of a range of rows.
+   *
+   * Computes the extremes of the values in rows \p startRow (inclusive)
+   * to \p endRow (exclusive) of the \p column, ignoring NaN values. If
+   * \p positiveOnly is \c true, only values greater than 0 are
+   * considered (e.g. for a logarithmic axis).
+   *
+   * Whole blocks are not read, but use the extremes that are kept by
+   * the model.
+   *
+   * If there are no such values, \p minimum is set to DBL_MAX and
+   * \p maximum to -DBL_MAX, and \c false is returned.
+   */
+  bool range(int column, int startRow, int endRow, bool positiveOnly,
+	     double& minimum, double& maximum) const;
+
+  virtual double data(int row, int column) const override;
+  virtual WString headerData(int column) const override;
+  virtual int columnCount() const override;
+  virtual int rowCount() const override;
+
+private:
+  struct Extremes {
+    double minimum, maximum, positiveMinimum;
+  };
+
+  struct Column {
+    std::vector<double> values;
+    std::vector<Extremes> blocks;
+    WString header;
+  };
+
+  std::vector<Column> columns_;
+
+  static void updateBlocks(Column& column, int startRow);
+  static void scan(const double *values, int count, Extremes& e);
+};
+
+  }
+}
+
+#endif // WCOLUMNAR_CHART_MODEL_H_
@@ -339,6 +339,46 @@ public:
    */
   FillRangeType fillRange() const;
 
+  /*! \brief Sets the decimation method for line or curve series.
+   *
+   * When a line or curve series has many more data points than the
+   * chart is wide, most of the segments of the line are drawn on top
+   * of each other, while they still need to be sent to the
+   * browser. Decimation reduces the number of points, before
+   * constructing the line, to roughly twice the number of pixel
+   * columns of the plot area:
+   * - DecimationMethod::MinMax keeps, for consecutive points that
+   *   fall in the same pixel column, the point with the minimum and
+   *   the point with the maximum value. This preserves the visual
+   *   envelope of the data, including peaks.
+   * - DecimationMethod::LargestTriangleThreeBuckets keeps, for
+   *   consecutive points that fall in the same half pixel column, the
+   *   point that forms the largest triangle with the previously kept
+   *   point and the average of the next column. This preserves the
+   *   shape of the data.
+   *
+   * The first and last point of the line (and of each part of the
+   * line between missing values) are always kept.
+   *
+   * The resolution follows the zoom level of the X axis. When the
+   * chart is interactive, zooming in requests the chart to be
+   * rendered again, at the higher resolution. Combine this with
+   * on-demand loading (WCartesianChart::setOnDemandLoadingEnabled())
+   * to only render the visible range.
+   *
+   * Decimation does not affect markers and labels, which are still
+   * drawn for each data point.
+   *
+   * The default value is DecimationMethod::None.
+   */
+  void setDecimation(DecimationMethod method);
+
+  /*! \brief Returns the decimation method.
+   *
+   * \sa setDecimation()
+   */
+  DecimationMethod decimation() const { return decimation_; }
+
   /*! \brief Sets the data point marker.
    *
    * Specifies a marker that is displayed at the (X,Y) coordinate for each
@@ -602,6 +642,7 @@ private:
   WColor             labelColor_;
   WShadow            shadow_;
   FillRangeType      fillRange_;
+  DecimationMethod   decimation_;
   MarkerType         marker_;
   double             markerSize_;
   bool               legend_;
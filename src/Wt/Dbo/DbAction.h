@@ -18,6 +18,7 @@
 #include <Wt/Dbo/Field.h>
 #include <Wt/Dbo/SqlStatement.h>
 #include <Wt/Dbo/Session.h>
+#include <Wt/Dbo/SharedCache.h>
 
 namespace Wt {
   namespace Dbo {
@@ -159,8 +160,15 @@ public:
   template<class D> void actId(ptr<D>& value, const std::string& name, int size,
 			       int fkConstraints);
 
+  /*
+   * Records the values that are read into row, for the shared
+   * cache.
+   */
+  void recordRow(Impl::CachedRow *row) { row_ = row; }
+
 private:
   MetaDbo<C>& dbo_;
+  Impl::CachedRow *row_;
 };
 
 template <class C>
@@ -206,7 +214,7 @@ protected:
   void startSelfPass();
   void startSetsPass();
 
-  void exec();
+  void exec(const std::function<void (int)>& checkModified);
 };
 
 template <class C>
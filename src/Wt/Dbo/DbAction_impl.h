@@ -278,7 +278,8 @@ template <class C>
 LoadDbAction<C>::LoadDbAction(MetaDbo<C>& dbo, Session::Mapping<C>& mapping,
 			      SqlStatement *statement, int& column)
   : LoadBaseAction(dbo, mapping, statement, column),
-    dbo_(dbo)
+    dbo_(dbo),
+    row_(nullptr)
 { }
 
 template<class C>
@@ -305,10 +306,19 @@ void LoadDbAction<C>::visit(C& obj)
     }
   }
 
+  std::unique_ptr<Impl::CachedRowStatement> recorder;
+  SqlStatement *source = statement_;
+  if (row_) {
+    recorder.reset(new Impl::CachedRowStatement(statement_, column_, row_));
+    statement_ = recorder.get();
+  }
+
   start();
 
   persist<C>::apply(obj, *this);
 
+  statement_ = source;
+
   if (!continueStatement && statement_->nextRow())
     throw Exception("Dbo load: multiple rows for id " + dbo_.idStr());
 
@@ -459,7 +469,7 @@ void SaveBaseAction::actCollection(const CollectionRef<C>& field)
 	    dbo1->bindId(statement, column);
 	    dbo2->bindId(statement, column);
 
-	    statement->execute();
+	    statement->executeDeferred([](int) { });
 	  }
 	}
 
@@ -486,7 +496,7 @@ void SaveBaseAction::actCollection(const CollectionRef<C>& field)
 	    dbo1->bindId(statement, column);
 	    dbo2->bindId(statement, column);
 
-	    statement->execute();
+	    statement->executeDeferred([](int) { });
 	  }
 	}
 
@@ -549,16 +559,17 @@ void SaveDbAction<C>::visit(C& obj)
       }
     }
 
-    exec();
+    if (!isInsert_ && mapping().versionFieldName) {
+      std::string idStr = dbo_.idStr();
+      const char *tableName = dbo_.session()->template tableName<C>();
+      int version = dbo_.version();
 
-    if (!isInsert_) {
-      int modifiedCount = statement_->affectedRowCount();
-      if (modifiedCount != 1 && mapping().versionFieldName) {
-        throw StaleObjectException(dbo_.idStr(),
-                                   dbo_.session()->template tableName<C>(),
-                                   dbo_.version());
-      }
-    }
+      exec([idStr, tableName, version](int modifiedCount) {
+	  if (modifiedCount != 1)
+	    throw StaleObjectException(idStr, tableName, version);
+	});
+    } else
+      exec([](int) { });
   }
 
   /*
@@ -0,0 +1,231 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2010 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_DBO_ELASTIC_SQL_CONNECTION_POOL_H_
+#define WT_DBO_ELASTIC_SQL_CONNECTION_POOL_H_
+
+#include <Wt/Dbo/SqlConnectionPool.h>
+
+#include <array>
+#include <chrono>
+#include <functional>
+#include <string>
+
+namespace Wt {
+  namespace Dbo {
+
+/*! \class ElasticSqlConnectionPool Wt/Dbo/ElasticSqlConnectionPool.h Wt/Dbo/ElasticSqlConnectionPool.h
+ *  \brief A connection pool that grows and shrinks with demand.
+ *
+ * The pool keeps at least a minimum number of connections, and opens
+ * new connections when all connections are in use, up to a maximum
+ * number. When that maximum is reached, getConnection() waits until
+ * a connection is returned.
+ *
+ * Idle connections are maintained periodically (by a background
+ * thread that is started by the first getConnection(), or when a
+ * connection is returned in a build without thread support), see
+ * maintain():
+ * - connections that have been idle for longer than the idleTimeout()
+ *   are closed, as long as more than the minimum number of
+ *   connections remain;
+ * - connections that have been idle for longer than the
+ *   validationInterval() are validated (by default by executing the
+ *   validationQuery()), and closed when they fail;
+ * - new connections are opened when fewer than the minimum number
+ *   remain.
+ *
+ * No database operations are done while holding the lock that
+ * protects the pool: getting or returning an idle connection takes
+ * only a short critical section.
+ *
+ * Usage statistics, including a histogram of the time spent waiting
+ * for a connection, are available through statistics().
+ *
+ * \ingroup dbo
+ */
+class WTDBO_API ElasticSqlConnectionPool : public SqlConnectionPool
+{
+public:
+  /*! \brief Typedef for a function that opens a new connection.
+   */
+  typedef std::function<std::unique_ptr<SqlConnection> ()> ConnectionFactory;
+
+  /*! \brief The number of buckets in the wait time histogram.
+   *
+   * \sa Statistics::waitTimeHistogram
+   */
+  static const int WaitTimeHistogramSize = 12;
+
+  /*! \brief Usage statistics.
+   *
+   * \sa statistics()
+   */
+  struct Statistics {
+    int size;    //!< Number of open connections
+    int inUse;   //!< Number of connections in use
+    int idle;    //!< Number of idle connections
+    int waiting; //!< Number of threads waiting for a connection
+
+    long long acquired; //!< Number of connections handed out
+    long long waited;   //!< Number of connections handed out after waiting
+    long long timeouts; //!< Number of getConnection() calls that timed out
+    long long opened;   //!< Number of connections opened
+    long long closed;   //!< Number of connections closed
+    long long validationFailures; //!< Number of failed validations
+
+    //! Total time spent waiting for a connection
+    std::chrono::steady_clock::duration waitTime;
+
+    /*! \brief Histogram of the time spent waiting for a connection.
+     *
+     * Bucket \p i counts the getConnection() calls that waited less
+     * than 2<sup>i</sup> ms (including those that did not wait at
+     * all, in bucket 0), the last bucket counts all longer waits.
+     */
+    std::array<long long, WaitTimeHistogramSize> waitTimeHistogram;
+  };
+
+  /*! \brief Creates an elastic connection pool.
+   *
+   * The pool opens connections using the \p factory, and opens \p
+   * minSize connections right away.
+   */
+  ElasticSqlConnectionPool(const ConnectionFactory& factory,
+			   int minSize, int maxSize);
+
+  /*! \brief Creates an elastic connection pool from a prototype
+   *         connection.
+   *
+   * New connections are opened by cloning the \p prototype, which is
+   * kept by the pool for this purpose only.
+   */
+  ElasticSqlConnectionPool(std::unique_ptr<SqlConnection> prototype,
+			   int minSize, int maxSize);
+
+  virtual ~ElasticSqlConnectionPool();
+
+  /*! \brief Sets a timeout to get a connection.
+   *
+   * When all connections are in use and the pool has reached its
+   * maximum size, getConnection() waits at most the given duration.
+   * On timeout, handleTimeout() is called, which throws an exception
+   * by default.
+   *
+   * By default, there is no timeout.
+   */
+  void setTimeout(std::chrono::steady_clock::duration timeout);
+
+  /*! \brief Returns the timeout to get a connection.
+   *
+   * \sa setTimeout()
+   */
+  std::chrono::steady_clock::duration timeout() const;
+
+  /*! \brief Sets the time after which an idle connection is closed.
+   *
+   * The default value is 5 minutes.
+   */
+  void setIdleTimeout(std::chrono::steady_clock::duration timeout);
+
+  /*! \brief Returns the time after which an idle connection is closed.
+   *
+   * \sa setIdleTimeout()
+   */
+  std::chrono::steady_clock::duration idleTimeout() const;
+
+  /*! \brief Sets the time after which an idle connection is validated.
+   *
+   * The default value is 30 seconds.
+   *
+   * \sa validate()
+   */
+  void setValidationInterval(std::chrono::steady_clock::duration interval);
+
+  /*! \brief Returns the time after which an idle connection is
+   *         validated.
+   *
+   * \sa setValidationInterval()
+   */
+  std::chrono::steady_clock::duration validationInterval() const;
+
+  /*! \brief Sets the query used to validate a connection.
+   *
+   * The default value is <tt>"select 1"</tt>.
+   *
+   * \sa validate()
+   */
+  void setValidationQuery(const std::string& sql);
+
+  /*! \brief Returns the query used to validate a connection.
+   *
+   * \sa setValidationQuery()
+   */
+  std::string validationQuery() const;
+
+  /*! \brief Returns usage statistics.
+   */
+  Statistics statistics() const;
+
+  /*! \brief Maintains the idle connections.
+   *
+   * Closes connections that have been idle for too long, validates
+   * idle connections, and opens new connections up to the minimum
+   * size.
+   *
+   * This is done periodically by the pool, but may be called to do
+   * this right away.
+   */
+  void maintain();
+
+  /*! \brief Stops the periodic maintenance.
+   *
+   * Stops the background thread, and waits until it is no longer
+   * maintaining connections. This is done by the destructor, but a
+   * class that reimplements validate() must call this from its own
+   * destructor, since the background thread may otherwise call
+   * validate() on a partially destroyed object.
+   *
+   * maintain() may still be called explicitly after this.
+   */
+  void stopMaintenance();
+
+  virtual std::unique_ptr<SqlConnection> getConnection() override;
+  virtual void returnConnection(std::unique_ptr<SqlConnection>) override;
+  virtual void prepareForDropTables() const override;
+
+protected:
+  /*! \brief Handle a timeout that occured while getting a connection.
+   *
+   * The default implementation throws an Exception.
+   *
+   * This is called without holding the pool's lock, so it may return
+   * connections to the pool. If the function returns cleanly, the
+   * timeout is reset and another attempt is made to obtain a
+   * connection.
+   */
+  virtual void handleTimeout();
+
+  /*! \brief Validates an idle connection.
+   *
+   * The default implementation executes the validationQuery(), and
+   * returns whether this succeeded.
+   */
+  virtual bool validate(SqlConnection& connection);
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+
+  void init();
+  void startMaintenance();
+  void run();
+};
+
+  }
+}
+
+#endif // WT_DBO_ELASTIC_SQL_CONNECTION_POOL_H_
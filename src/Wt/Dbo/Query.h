@@ -7,6 +7,8 @@
 #ifndef WT_DBO_QUERY_H_
 #define WT_DBO_QUERY_H_
 
+#include <exception>
+#include <functional>
 #include <vector>
 
 #include <Wt/Dbo/SqlTraits.h>
@@ -47,7 +49,14 @@ namespace Wt {
 
 	QueryBase& operator=(const QueryBase& other);
 
-	Result singleResult(const collection<Result>& results) const;
+	static Result singleResult(const collection<Result>& results);
+	static void resultListAsync
+	  (const collection<Result>& results,
+	   const std::function<void (std::exception_ptr,
+				     collection<Result>)>& callback);
+	static void resultValueAsync
+	  (const collection<Result>& results,
+	   const std::function<void (std::exception_ptr, Result)>& callback);
 
 	Session *session_;
 	std::string sql_;
@@ -397,6 +406,47 @@ public:
    */
   collection< Result > resultList() const;
 
+  /*! \brief Runs the query asynchronously, and returns a result list.
+   *
+   * Unlike resultList(), this executes the query immediately, but
+   * without blocking the calling thread while waiting for the
+   * result, if a Session::setAsyncSocketWait() function was
+   * configured and the backend supports this.
+   *
+   * The \p callback is called with the collection of results, or
+   * with the exception that occurred, from within the function that
+   * the wait function calls when the result is available: see
+   * Session::setAsyncSocketWait() on how to call it where the session
+   * may be used. The rows of the collection are then available in
+   * memory, so iterating it does not block.
+   *
+   * The transaction in which the query was created must be kept alive
+   * until the callback has been called.
+   *
+   * The timeout of the connection applies to the wait. When it
+   * expires, or the wait is cancelled, the callback is called with an
+   * exception, and the backend closes the connection since the query
+   * may still be running.
+   *
+   * \note Starting the transaction, and flushing the session, are
+   *       still done synchronously.
+   */
+  void resultListAsync(const std::function<void (std::exception_ptr,
+						 collection<Result>)>&
+		       callback) const;
+
+  /*! \brief Runs the query asynchronously, and returns a unique result
+   *         value.
+   *
+   * This is the asynchronous version of resultValue(). If the query
+   * returns more than one result, the \p callback is called with a
+   * NoUniqueResultException.
+   *
+   * \sa resultListAsync()
+   */
+  void resultValueAsync(const std::function<void (std::exception_ptr,
+						  Result)>& callback) const;
+
   /*! \brief Returns a unique result value.
    *
    * This is a convenience conversion operator that calls resultValue().
@@ -616,6 +666,11 @@ public:
   void reset();
   Result resultValue() const;
   collection< Result > resultList() const;
+  void resultListAsync(const std::function<void (std::exception_ptr,
+						 collection<Result>)>&
+		       callback) const;
+  void resultValueAsync(const std::function<void (std::exception_ptr,
+						  Result)>& callback) const;
   operator Result () const;
   operator collection< Result > () const;
 
@@ -657,6 +712,11 @@ public:
   Query<Result, DynamicBinding>& limit(int count);
   Result resultValue() const;
   collection< Result > resultList() const;
+  void resultListAsync(const std::function<void (std::exception_ptr,
+						 collection<Result>)>&
+		       callback) const;
+  void resultValueAsync(const std::function<void (std::exception_ptr,
+						  Result)>& callback) const;
   operator Result () const;
   operator collection< Result > () const;
 
@@ -58,7 +58,15 @@ class QueryColumn;
  *
  * To get good performance, the model keeps the following data cached:
  *  - rowCount()
- *  - a batch of data, controlled by setBatchSize()
+ *  - a number of batches of data, controlled by setBatchSize() and
+ *    setCacheSize()
+ *
+ * Batches are aligned on a multiple of the batch size, and the least
+ * recently used batch is discarded when the cache is full, so that
+ * scrolling back and forth, or several views on the same model, do
+ * not repeatedly query the same rows. When rows are accessed in the
+ * next (or previous) batch, the batch after it (or before it) is
+ * fetched in the same query.
  *
  * Moreover, the model will try to fetch a batch of data even if you
  * ask for the rowCount(), which may provide the row count as a
@@ -67,6 +75,10 @@ class QueryColumn;
  * you are only interested in rowCount(), not the actual data) then
  * you can avoid this behaviour by setting batchSize to 0.
  *
+ * Batches are fetched using an SQL <tt>offset</tt>, which becomes
+ * slow for large offsets with most databases. See
+ * setKeysetPagination() for an alternative.
+ *
  * \ingroup dbo modelview
  */
 template <class Result>
@@ -179,7 +191,11 @@ public:
    * could be used to customize the model behaviour, e.g. by
    * specializing data() for certain columns.
    *
-   * Returns a const reference to an entry in the result cache.
+   * Returns a const reference to an entry in the result cache. The
+   * reference remains valid until the batch that contains the row is
+   * discarded from the cache (see setCacheSize()), or the data is
+   * invalidated (e.g. by reload() or sort()). Copy the result to keep
+   * it for longer, e.g. while accessing other rows.
    */
   const Result& resultRow(int row) const;
 
@@ -189,7 +205,8 @@ public:
    * could be used to customize the model behaviour, e.g. by
    * specializing setData() for certain columns.
    *
-   * Returns a reference to an entry in the result cache.
+   * Returns a reference to an entry in the result cache, which
+   * remains valid as long as for resultRow(int row) const.
    *
    * \sa resultRow(int row) const
    */
@@ -225,6 +242,56 @@ public:
    */
   int batchSize() const { return batchSize_; }
 
+  /*! \brief Sets the number of batches that are cached.
+   *
+   * The default cache size is 4 batches.
+   *
+   * \sa setBatchSize()
+   */
+  void setCacheSize(int batches);
+
+  /*! \brief Returns the number of batches that are cached.
+   *
+   * \sa setCacheSize()
+   */
+  int cacheSize() const { return cacheSize_; }
+
+  /*! \brief Enables keyset pagination.
+   *
+   * When enabled, and the model is sorted using sort(), a batch that
+   * follows a cached batch is fetched by seeking past the last row of
+   * that batch, using a condition on the sort column and the id,
+   * rather than with an SQL <tt>offset</tt>. Unlike an offset, this
+   * can use an index, and is not slower for batches further in the
+   * result.
+   *
+   * This requires that the result has a surrogate id (such as a
+   * ptr<C>), which is then also added to the <tt>order by</tt> clause
+   * by sort() to break ties. The condition is added to the query using
+   * Query::where() with bound parameters, and thus the query may not
+   * use Query::orWhere(), nor have parameters bound to a clause that
+   * follows the <i>where</i> clause (such as Query::having()). The
+   * sort column must be of a basic type (a number, string, or date and
+   * time), and createOrderBy() must sort on the column only.
+   *
+   * This should be set before calling sort(). Batches that do not
+   * follow a cached batch are still fetched using an offset. Since
+   * databases differ in where they sort <tt>null</tt> values, an
+   * offset is also used when the sort column may be <tt>null</tt>,
+   * i.e. when its SQL type is not declared <tt>not null</tt> (such as
+   * a boost::optional, a ptr or a WDate), or is not known (such as
+   * a value computed by the query).
+   *
+   * The default value is \c false.
+   */
+  void setKeysetPagination(bool enabled);
+
+  /*! \brief Returns whether keyset pagination is enabled.
+   *
+   * \sa setKeysetPagination()
+   */
+  bool keysetPagination() const { return keysetPagination_; }
+
   /*! \brief Returns the query field list.
    *
    * This returns the field list from the underlying query.
@@ -400,20 +467,37 @@ protected:
   virtual Result resultById(long long id) const;
 
 private:
+  struct CachedBatch {
+    std::vector<Result> rows;
+    long long lastUsed;
+  };
+
   void cacheRow(int row) const;
+  void fetchBatches(int first, int count) const;
+  void evictBatches() const;
+  bool seekQuery(int batch, Query<Result>& query) const;
+  int cachedBatchSize() const { return std::max(batchSize_, 1); }
+
+  static bool bindKey(Query<Result>& query, const cpp17::any& key);
+  static bool isNullable(const FieldInfo& field);
 
   typedef std::vector<cpp17::any> AnyList;
   typedef std::map<int, long long> StableResultIdMap;
+  typedef std::map<int, CachedBatch> BatchCache;
 
   std::vector<QueryColumn> columns_;
 
   mutable Query<Result> query_;
-  int queryLimit_, queryOffset_, batchSize_;
+  int queryLimit_, queryOffset_, batchSize_, cacheSize_;
   mutable std::string sortOrderBy_;
+  int sortField_, idField_;
+  SortOrder sortOrder_;
+  bool keysetPagination_;
 
   mutable int cachedRowCount_;
-  mutable int cacheStart_;
-  mutable std::vector<Result> cache_;
+  mutable BatchCache cache_;
+  mutable long long cacheUse_;
+  mutable int lastBatch_;
 
   mutable int currentRow_;
   mutable AnyList rowValues_;
@@ -8,8 +8,11 @@
 #define WT_DBO_QUERY_MODEL_IMPL_H_
 
 #include <Wt/Dbo/QueryModel.h>
+#include <Wt/Dbo/Field.h>
 #include <Wt/Dbo/QueryColumn.h>
+#include <Wt/Dbo/WtSqlTraits.h>
 
+#include <algorithm>
 #include <string>
 
 namespace Wt {
@@ -18,8 +21,14 @@ namespace Wt {
 template <class Result>
 QueryModel<Result>::QueryModel()
   : batchSize_(40),
+    cacheSize_(4),
+    sortField_(-1),
+    idField_(-1),
+    sortOrder_(SortOrder::Ascending),
+    keysetPagination_(false),
     cachedRowCount_(-1),
-    cacheStart_(-1),
+    cacheUse_(0),
+    lastBatch_(-1),
     currentRow_(-1)
 { }
 
@@ -35,6 +44,7 @@ void QueryModel<Result>::setQuery(const Query<Result>& query,
     fields_ = query_.fields();
     columns_.clear();
     sortOrderBy_.clear();
+    sortField_ = -1;
     reset();
   } else {
     invalidateData();
@@ -59,7 +69,25 @@ Query<Result> QueryModel<Result>::query() const
 template <class Result>
 void QueryModel<Result>::setBatchSize(int count)
 {
-  batchSize_ = count;
+  if (count != batchSize_) {
+    batchSize_ = count;
+    cache_.clear();
+    lastBatch_ = -1;
+  }
+}
+
+template <class Result>
+void QueryModel<Result>::setCacheSize(int batches)
+{
+  cacheSize_ = std::max(batches, 1);
+
+  evictBatches();
+}
+
+template <class Result>
+void QueryModel<Result>::setKeysetPagination(bool enabled)
+{
+  keysetPagination_ = enabled;
 }
 
 template <class Result>
@@ -204,7 +232,7 @@ void QueryModel<Result>::invalidateData()
 {
   layoutAboutToBeChanged().emit();
 
-  cachedRowCount_ = cacheStart_ = currentRow_ = -1;
+  cachedRowCount_ = lastBatch_ = currentRow_ = -1;
   cache_.clear();
   rowValues_.clear();
   stableIds_.clear();
@@ -227,12 +255,45 @@ void QueryModel<Result>::sort(int column, SortOrder order)
   invalidateData();
 
   sortOrderBy_ = createOrderBy(column, order);
+  sortField_ = columns_[column].fieldIdx_;
+  sortOrder_ = order;
+
+  /*
+   * Databases differ in where null values are sorted, and a null
+   * value cannot be seeked past: use an offset for a nullable column.
+   */
+  idField_ = -1;
+  if (keysetPagination_ && !isNullable(fields_[sortField_])) {
+    for (unsigned i = 0; i < fields_.size(); ++i)
+      if (fields_[i].isSurrogateIdField()) {
+	idField_ = i;
+	sortOrderBy_ += ", " + fields_[i].sql()
+	  + (order == SortOrder::Ascending ? " asc" : " desc");
+	break;
+      }
+  }
+
   query_.orderBy(sortOrderBy_);
 
   cachedRowCount_ = rc;
   dataReloaded();
 }
 
+template <class Result>
+bool QueryModel<Result>::isNullable(const FieldInfo& field)
+{
+  if (field.isForeignKey()
+      && !(field.fkConstraints() & Impl::FKNotNull))
+    return true;
+
+  const std::string& type = field.sqlType();
+  const std::string notNull = " not null";
+
+  return type.length() <= notNull.length()
+    || type.compare(type.length() - notNull.length(), notNull.length(),
+		    notNull) != 0;
+}
+
 template <class Result>
 std::string QueryModel<Result>::createOrderBy(int column, SortOrder order)
 {
@@ -256,13 +317,17 @@ Result& QueryModel<Result>::resultRow(int row)
 {
   cacheRow(row);
 
-  if (row >= cacheStart_ + static_cast<int>(cache_.size()))
+  int size = cachedBatchSize();
+  int batchStart = row - row % size;
+  std::vector<Result>& rows = cache_[row / size].rows;
+
+  if (row >= batchStart + static_cast<int>(rows.size()))
     throw Exception("QueryModel: geometry inconsistent with database: "
                     "row (= " + std::to_string(row) + ") >= "
-                    "cacheStart_ (= " + std::to_string(cacheStart_) + ") + "
-                    "cache_.size() (= " + std::to_string(cache_.size()) + ")");
+                    "batch start (= " + std::to_string(batchStart) + ") + "
+                    "batch size (= " + std::to_string(rows.size()) + ")");
 
-  return cache_[row - cacheStart_];
+  return rows[row - batchStart];
 }
 
 template <class Result>
@@ -279,37 +344,181 @@ int QueryModel<Result>::indexOf(const Result& result) const
 template <class Result>
 void QueryModel<Result>::cacheRow(int row) const
 {
-  if (row < cacheStart_
-      || row >= cacheStart_ + static_cast<int>(cache_.size())) {
-    cacheStart_ = std::max(row - batchSize_ / 4, 0);
+  int size = cachedBatchSize();
+  int batch = row / size;
 
-    int qOffset = cacheStart_;
-    if (queryOffset_ > 0)
-      qOffset += queryOffset_;
-    query_.offset(qOffset);
+  typename BatchCache::iterator i = cache_.find(batch);
 
-    int qLimit = batchSize_;
-    if (queryLimit_ > 0)
-      qLimit = std::min(batchSize_, queryLimit_ - cacheStart_);
-    query_.limit(qLimit);
+  if (i != cache_.end()
+      && row % size < static_cast<int>(i->second.rows.size()))
+    i->second.lastUsed = ++cacheUse_;
+  else {
+    /*
+     * When moving to the next or previous batch, we also fetch the
+     * batch that follows in that direction.
+     */
+    int first = batch, count = 1;
+
+    if (cacheSize_ > 1 && lastBatch_ != -1) {
+      if (batch == lastBatch_ + 1 && cache_.find(batch + 1) == cache_.end())
+	count = 2;
+      else if (batch == lastBatch_ - 1 && batch > 0
+	       && cache_.find(batch - 1) == cache_.end()) {
+	first = batch - 1;
+	count = 2;
+      }
+    }
 
-    Transaction transaction(query_.session());
+    fetchBatches(first, count);
+  }
 
-    collection<Result> results = query_.resultList();
-    cache_.clear();
-    cache_.insert(cache_.end(), results.begin(), results.end());   
+  lastBatch_ = batch;
+}
 
-    for (unsigned i = 0; i < cache_.size(); ++i) {
-      long long id = resultId(cache_[i]);
-      if (id != -1)
-	stableIds_[cacheStart_ + i] = id;
+template <class Result>
+void QueryModel<Result>::fetchBatches(int first, int count) const
+{
+  int size = cachedBatchSize();
+  int start = first * size;
+
+  int qLimit = count * size;
+  if (queryLimit_ > 0)
+    qLimit = std::min(qLimit, queryLimit_ - start);
+
+  std::vector<Result> results;
+
+  if (qLimit > 0) {
+    Transaction transaction(query_.session());
+
+    Query<Result> query = query_;
+    if (!seekQuery(first, query)) {
+      int qOffset = start;
+      if (queryOffset_ > 0)
+	qOffset += queryOffset_;
+      query.offset(qOffset);
     }
-    if (static_cast<int>(cache_.size()) < qLimit
-        && qOffset == 0 && cachedRowCount_ == -1)
-      cachedRowCount_ = cache_.size();
+    query.limit(qLimit);
+
+    collection<Result> c = query.resultList();
+    results.insert(results.end(), c.begin(), c.end());
 
     transaction.commit();
   }
+
+  for (unsigned i = 0; i < results.size(); ++i) {
+    long long id = resultId(results[i]);
+    if (id != -1)
+      stableIds_[start + i] = id;
+  }
+
+  if (static_cast<int>(results.size()) < qLimit
+      && (start == 0 || !results.empty()) && cachedRowCount_ == -1)
+    cachedRowCount_ = start + results.size();
+
+  for (int b = 0; b < count; ++b) {
+    std::size_t begin = std::min(results.size(), std::size_t(b * size));
+    std::size_t end = std::min(results.size(), std::size_t((b + 1) * size));
+
+    if (b > 0 && begin == end)
+      break;
+
+    CachedBatch& batch = cache_[first + b];
+    batch.rows.assign(results.begin() + begin, results.begin() + end);
+    batch.lastUsed = ++cacheUse_;
+  }
+
+  evictBatches();
+}
+
+template <class Result>
+void QueryModel<Result>::evictBatches() const
+{
+  while (static_cast<int>(cache_.size()) > cacheSize_) {
+    typename BatchCache::iterator lru = cache_.begin();
+    for (typename BatchCache::iterator i = cache_.begin();
+	 i != cache_.end(); ++i)
+      if (i->second.lastUsed < lru->second.lastUsed)
+	lru = i;
+    cache_.erase(lru);
+  }
+}
+
+/*
+ * Adds a condition to the query to seek past the last row of the
+ * previous batch, for keyset pagination.
+ */
+template <class Result>
+bool QueryModel<Result>::seekQuery(int batch, Query<Result>& query) const
+{
+  if (!keysetPagination_ || batch == 0 || sortField_ == -1 || idField_ == -1)
+    return false;
+
+  typename BatchCache::const_iterator i = cache_.find(batch - 1);
+  if (i == cache_.end()
+      || static_cast<int>(i->second.rows.size()) != cachedBatchSize())
+    return false;
+
+  const Result& last = i->second.rows.back();
+
+  long long id = resultId(last);
+  if (id == -1)
+    return false;
+
+  AnyList values;
+  query_result_traits<Result>::getValues(last, values);
+  const cpp17::any& key = values[sortField_];
+
+  std::string column = fields_[sortField_].sql();
+  std::string op = sortOrder_ == SortOrder::Ascending ? " > ?" : " < ?";
+
+  Query<Result> seek = query;
+  seek.where(column + op + " or (" + column + " = ? and "
+	     + fields_[idField_].sql() + op + ")");
+  if (!bindKey(seek, key) || !bindKey(seek, key))
+    return false;
+  seek.bind(id);
+  seek.offset(-1);
+
+  query = seek;
+
+  return true;
+}
+
+template <class Result>
+bool QueryModel<Result>::bindKey(Query<Result>& query, const cpp17::any& key)
+{
+  const std::type_info& type = key.type();
+
+  if (type == typeid(std::string))
+    query.bind(cpp17::any_cast<std::string>(key));
+  else if (type == typeid(WString))
+    query.bind(cpp17::any_cast<WString>(key));
+  else if (type == typeid(int))
+    query.bind(cpp17::any_cast<int>(key));
+  else if (type == typeid(long long))
+    query.bind(cpp17::any_cast<long long>(key));
+  else if (type == typeid(long))
+    query.bind(cpp17::any_cast<long>(key));
+  else if (type == typeid(short))
+    query.bind(cpp17::any_cast<short>(key));
+  else if (type == typeid(bool))
+    query.bind(cpp17::any_cast<bool>(key));
+  else if (type == typeid(double))
+    query.bind(cpp17::any_cast<double>(key));
+  else if (type == typeid(float))
+    query.bind(cpp17::any_cast<float>(key));
+  else if (type == typeid(WDate))
+    query.bind(cpp17::any_cast<WDate>(key));
+  else if (type == typeid(WDateTime))
+    query.bind(cpp17::any_cast<WDateTime>(key));
+  else if (type == typeid(WTime))
+    query.bind(cpp17::any_cast<WTime>(key));
+  else if (type == typeid(std::chrono::system_clock::time_point))
+    query.bind(cpp17::any_cast<std::chrono::system_clock::time_point>(key));
+  else
+    return false;
+
+  return true;
 }
 
 template <class Result>
@@ -416,9 +625,11 @@ bool QueryModel<Result>::insertRows(int row, int count,
      * Insert also into cache, this avoids a useless insert+query
      * when insertion is followed by setData() calls.
      */
-    if (cacheStart_ != -1
-	&& cacheStart_ + (int)cache_.size() == row + i)
-      cache_.push_back(r);
+    int size = cachedBatchSize();
+    typename BatchCache::iterator b = cache_.find((row + i) / size);
+    if (b != cache_.end()
+	&& static_cast<int>(b->second.rows.size()) == (row + i) % size)
+      b->second.rows.push_back(r);
   }
 
   cachedRowCount_ += count;
@@ -434,11 +645,22 @@ bool QueryModel<Result>::removeRows(int row, int count,
 {
   beginRemoveRows(parent, row, row + count - 1);
   
+  int size = cachedBatchSize();
+
   for (int i = 0; i < count; ++i) {
     deleteRow(resultRow(row));
-    cache_.erase(cache_.begin() + (row - cacheStart_));
+
+    std::vector<Result>& rows = cache_[row / size].rows;
+    rows.erase(rows.begin() + row % size);
   }
 
+  /*
+   * The following batches have shifted: the batch that contains row
+   * is refetched when reading beyond the rows it still has.
+   */
+  cache_.erase(cache_.upper_bound(row / size), cache_.end());
+  currentRow_ = -1;
+
   cachedRowCount_ -= count;
 
   endRemoveRows();
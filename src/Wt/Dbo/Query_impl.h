@@ -185,7 +185,7 @@ Session& QueryBase<Result>::session() const
 }
 
 template <class Result>
-Result QueryBase<Result>::singleResult(const collection<Result>& results) const
+Result QueryBase<Result>::singleResult(const collection<Result>& results)
 {
   typename collection<Result>::const_iterator i = results.begin();
   if (i == results.end())
@@ -198,6 +198,38 @@ Result QueryBase<Result>::singleResult(const collection<Result>& results) const
     return result;
   }
 }
+
+template <class Result>
+void QueryBase<Result>::resultListAsync
+  (const collection<Result>& results,
+   const std::function<void (std::exception_ptr, collection<Result>)>& callback)
+{
+  results.executeAsync(callback);
+}
+
+template <class Result>
+void QueryBase<Result>::resultValueAsync
+  (const collection<Result>& results,
+   const std::function<void (std::exception_ptr, Result)>& callback)
+{
+  results.executeAsync
+    ([callback](std::exception_ptr error, collection<Result> results) {
+      if (error) {
+	callback(error, Result());
+	return;
+      }
+
+      Result result;
+      try {
+	result = singleResult(results);
+      } catch (...) {
+	callback(std::current_exception(), Result());
+	return;
+      }
+
+      callback(nullptr, result);
+    });
+}
     }
 
 template <class Result>
@@ -277,6 +309,21 @@ collection<Result> Query<Result, DirectBinding>::resultList() const
   return collection<Result>(this->session_, s, cs);
 }
 
+template <class Result>
+void Query<Result, DirectBinding>::resultListAsync
+(const std::function<void (std::exception_ptr, collection<Result>)>& callback)
+  const
+{
+  Impl::QueryBase<Result>::resultListAsync(resultList(), callback);
+}
+
+template <class Result>
+void Query<Result, DirectBinding>::resultValueAsync
+(const std::function<void (std::exception_ptr, Result)>& callback) const
+{
+  Impl::QueryBase<Result>::resultValueAsync(resultList(), callback);
+}
+
 template <class Result>
 Query<Result, DirectBinding>::operator Result () const
 {
@@ -473,6 +520,21 @@ collection<Result> Query<Result, DynamicBinding>::resultList() const
   return collection<Result>(this->session_, statement, countStatement);
 }
 
+template <class Result>
+void Query<Result, DynamicBinding>::resultListAsync
+(const std::function<void (std::exception_ptr, collection<Result>)>& callback)
+  const
+{
+  Impl::QueryBase<Result>::resultListAsync(resultList(), callback);
+}
+
+template <class Result>
+void Query<Result, DynamicBinding>::resultValueAsync
+(const std::function<void (std::exception_ptr, Result)>& callback) const
+{
+  Impl::QueryBase<Result>::resultValueAsync(resultList(), callback);
+}
+
 template <class Result>
 Query<Result, DynamicBinding>::operator Result () const
 {
@@ -22,6 +22,7 @@ namespace Wt {
   namespace Dbo {
     namespace Impl {
       struct MetaDboBaseSet;
+      struct CachedRow;
 
       extern WTDBO_API std::string quoteSchemaDot(const std::string& table);
       template <class C, typename T> struct LoadHelper;
@@ -93,6 +94,7 @@ enum class FlushMode {
 
 class Call;
 //class SqlConnection;
+class SharedCache;
 class SqlConnectionPool;
 class SqlStatement;
 template <typename Result, typename BindStrategy> class Query;
@@ -506,6 +508,63 @@ public:
    */
   void setFlushMode(FlushMode mode) { flush(); flushMode_ = mode; }
 
+  /*! \brief Sets the function used to wait for asynchronous queries.
+   *
+   * Queries that are run using Query::resultListAsync() or
+   * Query::resultValueAsync() use this function to wait for the
+   * result, without blocking the thread, if the backend supports
+   * this (currently only backend::Postgres). Otherwise, or when no
+   * function is set, these queries are executed synchronously.
+   *
+   * The query is completed, and its callback is called, from within
+   * the \c done function that is passed to the wait function. Since
+   * this uses the session (and the callback typically too), \c done
+   * must be called where the session may be used: for a session that
+   * is owned by a Wt application, post it to the application's
+   * session. To use the reactor of the Wt server:
+   * \code
+   * Wt::WServer *server = Wt::WServer::instance();
+   * std::string sessionId = Wt::WApplication::instance()->sessionId();
+   *
+   * session.setAsyncSocketWait
+   *   ([server, sessionId](int socket,
+   *                        std::chrono::steady_clock::duration timeout,
+   *                        const std::function<void (bool)>& done) {
+   *     server->ioService().waitReadable
+   *       (socket, timeout, [server, sessionId, done](bool readable) {
+   *         server->post(sessionId, std::bind(done, readable));
+   *       });
+   *   });
+   * \endcode
+   *
+   * If the application session was terminated in the meantime, \c
+   * done is not called: the session (and the query) no longer exist.
+   */
+  void setAsyncSocketWait(const AsyncSocketWait& wait);
+
+  /*! \brief Returns the function used to wait for asynchronous queries.
+   *
+   * \sa setAsyncSocketWait()
+   */
+  const AsyncSocketWait& asyncSocketWait() const { return asyncSocketWait_; }
+
+  /*! \brief Sets a shared (second-level) cache.
+   *
+   * Objects of tables that are cached by the \p cache are loaded
+   * from the cache when available, and stored in the cache when
+   * loaded from the database. The cache is typically shared by all
+   * sessions that use the same database.
+   *
+   * The default value is \c nullptr (no shared cache).
+   */
+  void setSharedCache(SharedCache *cache);
+
+  /*! \brief Returns the shared cache.
+   *
+   * \sa setSharedCache()
+   */
+  SharedCache *sharedCache() const { return sharedCache_; }
+
 private:
   mutable std::string longlongType_;
   mutable std::string intType_;
@@ -567,6 +626,8 @@ private:
   SqlConnectionPool *connectionPool_;
   Transaction::Impl *transaction_;
   FlushMode flushMode_;
+  AsyncSocketWait asyncSocketWait_;
+  SharedCache *sharedCache_;
 
   void initSchema() const;
   void resolveJoinIds(Impl::MappingInfo *mapping);
@@ -635,6 +696,14 @@ private:
   template<class C> void implLoad(MetaDbo<C>& dbo, SqlStatement *statement,
 				  int& column);
 
+  long long sharedCacheGeneration() const;
+  bool isSharedCached(const char *tableName) const;
+  std::shared_ptr<const Impl::CachedRow>
+    findShared(const char *tableName, const std::string& id);
+  void storeShared(const char *tableName, const std::string& id,
+		   const std::shared_ptr<const Impl::CachedRow>& row);
+  void invalidateShared(const char *tableName, const std::string& id);
+
   static std::string statementId(const char *table, int statementIdx);
 
   template <class C> SqlStatement *getStatement(int statementIdx);
@@ -9,6 +9,7 @@
 
 #include <iostream>
 
+#include <Wt/Dbo/SharedCache.h>
 #include <Wt/Dbo/SqlConnection.h>
 #include <Wt/Dbo/Query.h>
 
@@ -303,10 +304,15 @@ void Session::implSave(MetaDbo<C>& dbo)
 
   Session::Mapping<C> *mapping = getMapping<C>();
 
+  bool isNew = dbo.isNew();
+
   SaveDbAction<C> action(dbo, *mapping);
   action.visit(*dbo.obj());
 
   mapping->registry_[dbo.id()] = &dbo;
+
+  if (!isNew)
+    invalidateShared(mapping->tableName, dbo.idStr());
 }
 
 template<class C>
@@ -328,6 +334,8 @@ void Session::implDelete(MetaDbo<C>& dbo)
   statement->reset();
   ScopedStatementUse use(statement);
 
+  invalidateShared(tableName<C>(), dbo.idStr());
+
   int column = 0;
   dbo.bindModifyId(statement, column);
 
@@ -337,19 +345,28 @@ void Session::implDelete(MetaDbo<C>& dbo)
     statement->bind(column++, version);
   }
 
-  statement->execute();
-
   if (versioned) {
-    int modifiedCount = statement->affectedRowCount();
-    if (modifiedCount != 1)
-      throw StaleObjectException(std::string()/*std::to_string(dbo.id())*/,
-                                 this->tableName<C>(), version);
-  }
+    const char *tableName = this->tableName<C>();
+
+    statement->executeDeferred([tableName, version](int modifiedCount) {
+	if (modifiedCount != 1)
+	  throw StaleObjectException(std::string()/*std::to_string(dbo.id())*/,
+				     tableName, version);
+      });
+  } else
+    statement->executeDeferred([](int) { });
 }
 
 template<class C>
 void Session::implTransactionDone(MetaDbo<C>& dbo, bool success)
 {
+  /*
+   * Invalidate (again) after commit: another session may have stored
+   * the old version in the mean time.
+   */
+  if (success)
+    invalidateShared(tableName<C>(), dbo.idStr());
+
   TransactionDoneAction action(dbo, *this, *getMapping<C>(), success);
   action.visit(*dbo.obj());
 }
@@ -360,7 +377,28 @@ void Session::implLoad(MetaDbo<C>& dbo, SqlStatement *statement, int& column)
   if (!transaction_)
     throw Exception("Dbo load(): no active transaction");
 
-  LoadDbAction<C> action(dbo, *getMapping<C>(), statement, column);
+  Mapping<C> *mapping = getMapping<C>();
+
+  /*
+   * Consult the shared cache when loading by id, and record the
+   * values that are read from the database otherwise.
+   */
+  bool shared = isSharedCached(mapping->tableName);
+
+  std::shared_ptr<const Impl::CachedRow> cached;
+  if (shared && !statement)
+    cached = findShared(mapping->tableName, dbo.idStr());
+
+  Impl::CachedRowStatement replay(cached.get());
+  int replayColumn = 0;
+
+  std::shared_ptr<Impl::CachedRow> row;
+  if (shared && !cached)
+    row = std::make_shared<Impl::CachedRow>();
+
+  LoadDbAction<C> action(dbo, *mapping, cached ? &replay : statement,
+			 cached ? replayColumn : column);
+  action.recordRow(row.get());
 
   C *obj = new C();
   try {
@@ -370,6 +408,11 @@ void Session::implLoad(MetaDbo<C>& dbo, SqlStatement *statement, int& column)
     delete obj;
     throw;
   }
+
+  if (row && !(dbo.id() == dbo_traits<C>::invalidId())) {
+    row->version = dbo.version();
+    storeShared(mapping->tableName, dbo.idStr(), row);
+  }
 }
 
 template <class C>
@@ -0,0 +1,258 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2008 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_DBO_SHARED_CACHE_H_
+#define WT_DBO_SHARED_CACHE_H_
+
+#include <Wt/Dbo/SqlStatement.h>
+#include <Wt/Dbo/WDboDllDefs.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Wt {
+  namespace Dbo {
+    namespace Impl {
+
+/*
+ * The values that were read for a single database object, in the
+ * order in which LoadDbAction reads them.
+ */
+struct WTDBO_API CachedValue
+{
+  CachedValue();
+
+  bool isNull;
+  long long integer;
+  double real;
+  std::chrono::system_clock::time_point time;
+  std::string data;
+};
+
+struct WTDBO_API CachedRow
+{
+  int version;
+  std::vector<CachedValue> values;
+};
+
+/*
+ * A statement that either records the values that are read from
+ * another statement (which is positioned at the row), or replays the
+ * values of a cached row.
+ */
+class WTDBO_API CachedRowStatement final : public SqlStatement
+{
+public:
+  // Records into row, the values of source read from firstColumn
+  CachedRowStatement(SqlStatement *source, int firstColumn, CachedRow *row);
+
+  // Replays row, starting at column 0
+  CachedRowStatement(const CachedRow *row);
+
+  virtual void reset() override;
+  virtual void bind(int column, const std::string& value) override;
+  virtual void bind(int column, short value) override;
+  virtual void bind(int column, int value) override;
+  virtual void bind(int column, long long value) override;
+  virtual void bind(int column, float value) override;
+  virtual void bind(int column, double value) override;
+  virtual void bind(int column,
+		    const std::chrono::system_clock::time_point& value,
+		    SqlDateTimeType type) override;
+  virtual void bind(int column,
+		    const std::chrono::duration<int, std::milli>& value)
+    override;
+  virtual void bind(int column, const std::vector<unsigned char>& value)
+    override;
+  virtual void bindNull(int column) override;
+  virtual void execute() override;
+  virtual long long insertedId() override;
+  virtual int affectedRowCount() override;
+  virtual bool nextRow() override;
+  virtual int columnCount() const override;
+  virtual bool getResult(int column, std::string *value, int size) override;
+  virtual bool getResult(int column, short *value) override;
+  virtual bool getResult(int column, int *value) override;
+  virtual bool getResult(int column, long long *value) override;
+  virtual bool getResult(int column, float *value) override;
+  virtual bool getResult(int column, double *value) override;
+  virtual bool getResult(int column,
+			 std::chrono::system_clock::time_point *value,
+			 SqlDateTimeType type) override;
+  virtual bool getResult(int column,
+			 std::chrono::duration<int, std::milli> *value)
+    override;
+  virtual bool getResult(int column, std::vector<unsigned char> *value,
+			 int size) override;
+  virtual std::string sql() const override;
+
+private:
+  SqlStatement *source_;
+  int firstColumn_;
+  CachedRow *row_;
+  const CachedRow *replay_;
+
+  CachedValue *record(int column, bool notNull);
+  const CachedValue& value(int column) const;
+};
+
+    }
+
+/*! \class SharedCache Wt/Dbo/SharedCache.h Wt/Dbo/SharedCache.h
+ *  \brief A second-level object cache, shared between sessions.
+ *
+ * Each Session keeps the objects it loaded in its own registry, but
+ * in an application with many sessions that read the same data
+ * (e.g. reference tables), each session still needs to query the
+ * database for these objects. A shared cache keeps the values of
+ * loaded objects, keyed on table and id (together with their
+ * version), so that a session can load an object from the cache
+ * instead of querying the database.
+ *
+ * Only tables for which a Policy was configured are cached:
+ * \code
+ * Wt::Dbo::SharedCache cache;
+ * cache.setPolicy("country", Wt::Dbo::SharedCache::Policy());
+ *
+ * // for every session
+ * session.setSharedCache(&cache);
+ * \endcode
+ *
+ * Objects are stored in the cache when they are loaded by a session,
+ * either by Session::load(), by dereferencing a lazy ptr, or as the
+ * result of a Query. Session::load() and lazy loading consult the
+ * cache before querying the database. A Query always executes
+ * against the database, but the cache entry is refreshed when the
+ * query returns a newer version of the object.
+ *
+ * Cache entries are invalidated when a session flushes changes to an
+ * object (or deletes it), and again when its transaction is
+ * committed. To avoid storing a copy that was read before a
+ * concurrent change was committed, a session does not store objects
+ * of a table that was invalidated after its current transaction
+ * started. Rereading an object (ptr::reread()) also invalidates its
+ * cache entry.
+ *
+ * Changes that are made to the database outside of Wt::Dbo are not
+ * noticed: use a timeToLive in the policy, or invalidate() the
+ * cache explicitly, for tables that are modified in this way.
+ *
+ * The cache is thread-safe, and is typically used by all sessions
+ * of a process. It should outlive the sessions that use it.
+ *
+ * \sa Session::setSharedCache()
+ *
+ * \ingroup dbo
+ */
+class WTDBO_API SharedCache
+{
+public:
+  /*! \brief A cache policy for a table.
+   */
+  struct WTDBO_API Policy {
+    /*! \brief Default constructor.
+     *
+     * Caches at most 10000 objects, which do not expire.
+     */
+    Policy();
+
+    /*! \brief The maximum number of cached objects.
+     *
+     * When more objects are loaded, the least recently used objects
+     * are evicted. A value of 0 means that the number is not
+     * limited.
+     */
+    std::size_t maxEntries;
+
+    /*! \brief The time after which a cached object expires.
+     *
+     * A zero duration means that objects do not expire.
+     */
+    std::chrono::steady_clock::duration timeToLive;
+  };
+
+  /*! \brief Cache statistics.
+   *
+   * \sa statistics()
+   */
+  struct Statistics {
+    long long hits;          //!< Number of objects found in the cache
+    long long misses;        //!< Number of objects not found
+    long long stores;        //!< Number of objects stored
+    long long invalidations; //!< Number of invalidated objects
+    long long evictions;     //!< Number of evicted or expired objects
+    std::size_t size;        //!< Number of objects in the cache
+  };
+
+  /*! \brief Creates a cache.
+   *
+   * Initially, no tables are cached.
+   */
+  SharedCache();
+
+  ~SharedCache();
+
+  SharedCache(const SharedCache&) = delete;
+  SharedCache& operator=(const SharedCache&) = delete;
+
+  /*! \brief Configures caching for a table.
+   *
+   * The \p tableName is the name by which the class is mapped, see
+   * Session::mapClass().
+   */
+  void setPolicy(const std::string& tableName, const Policy& policy);
+
+  /*! \brief Disables caching for a table.
+   *
+   * The objects of the table are removed from the cache.
+   */
+  void removePolicy(const std::string& tableName);
+
+  /*! \brief Returns whether a table is cached.
+   *
+   * \sa setPolicy()
+   */
+  bool isCached(const std::string& tableName) const;
+
+  /*! \brief Invalidates an object.
+   *
+   * The \p id is the object id (ptr::id()), converted to a string
+   * using <tt>operator<<</tt>.
+   */
+  void invalidate(const std::string& tableName, const std::string& id);
+
+  /*! \brief Invalidates all objects of a table.
+   */
+  void invalidate(const std::string& tableName);
+
+  /*! \brief Invalidates all objects.
+   */
+  void clear();
+
+  /*! \brief Returns cache statistics.
+   */
+  Statistics statistics() const;
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+
+  typedef std::shared_ptr<const Wt::Dbo::Impl::CachedRow> RowPtr;
+
+  long long generation() const;
+  RowPtr find(const std::string& tableName, const std::string& id);
+  void store(const std::string& tableName, const std::string& id,
+	     const RowPtr& row, long long generation);
+
+  friend class Session;
+};
+
+  }
+}
+
+#endif // WT_DBO_SHARED_CACHE_H_
@@ -7,6 +7,8 @@
 #ifndef WT_DBO_SQL_CONNECTION_H_
 #define WT_DBO_SQL_CONNECTION_H_
 
+#include <chrono>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -38,6 +40,27 @@ enum class LimitQuery{
   NotSupported // !< Not supported
 };
 
+/*! \brief Function that waits until a socket is readable.
+ *
+ * The function should return immediately, and invoke \p done (from
+ * any thread) with \c true once data can be read from \p socket, or
+ * an error occurred on it. If that did not happen within \p timeout
+ * (unless it is zero), or the wait is cancelled, it should invoke
+ * \p done with \c false instead. The statement is completed within
+ * \p done, which should thus be invoked where the session that runs
+ * the statement may be used.
+ *
+ * It is used to execute statements without blocking the calling
+ * thread, and is typically implemented using the reactor of an
+ * event loop, such as Wt::WIOService::waitReadable().
+ *
+ * \sa Session::setAsyncSocketWait()
+ */
+typedef std::function<void (int socket,
+			    std::chrono::steady_clock::duration timeout,
+			    const std::function<void (bool readable)>& done)>
+  AsyncSocketWait;
+
 class SqlStatement;
 
 /*! \class SqlConnection Wt/Dbo/SqlConnection.h Wt/Dbo/SqlConnection.h
@@ -109,6 +132,19 @@ public:
    * This function rolls back a transaction.
    */
   virtual void rollbackTransaction() = 0;
+
+  /*! \brief Completes statements of which the result was deferred.
+   *
+   * Waits for the results of statements that were executed using
+   * SqlStatement::executeDeferred(), and calls their completion
+   * functions. If one of these statements failed, the exception is
+   * thrown after all results have been received, and the completion
+   * functions of the failed statement and the statements that
+   * followed it are not called.
+   *
+   * The default implementation does nothing.
+   */
+  virtual void completeDeferred();
   
   /*! \brief Returns the statement with the given id.
    *
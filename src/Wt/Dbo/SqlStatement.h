@@ -10,6 +10,8 @@
 #include <string>
 #include <vector>
 #include <chrono>
+#include <exception>
+#include <functional>
 
 #include <Wt/Dbo/SqlConnection.h>
 
@@ -103,6 +105,41 @@ public:
    */
   virtual void execute() = 0;
 
+  /*! \brief Executes the statement asynchronously.
+   *
+   * Sends the statement to the database and returns, using \p wait
+   * to be notified when the result is available. When the statement
+   * has been executed, \p done is called with a null pointer, or
+   * with the exception that occurred. The result rows can then be
+   * fetched with nextRow() without further blocking.
+   *
+   * The default implementation executes the statement synchronously,
+   * using execute(), and then calls \p done.
+   */
+  virtual void executeAsync(const AsyncSocketWait& wait,
+			    const std::function<void (std::exception_ptr)>&
+			    done);
+
+  /*! \brief Executes the statement, possibly deferring its result.
+   *
+   * This is used for statements of which the result is not needed
+   * right away: a backend may send the statement and return without
+   * waiting for its result, so that a batch of statements can be
+   * sent at once. The \p done function is called with the
+   * affectedRowCount() when the result is available, at the latest
+   * by SqlConnection::completeDeferred(). It may throw an exception
+   * to signal that the result was not as expected.
+   *
+   * If the statement fails, or is not executed because an earlier
+   * deferred statement failed, \p done is not called: the error is
+   * thrown instead (by this method or by completeDeferred()), and the
+   * transaction must be rolled back.
+   *
+   * The default implementation executes the statement using
+   * execute(), and then calls \p done.
+   */
+  virtual void executeDeferred(const std::function<void (int)>& done);
+
   /*! \brief Returns the id if the statement was an SQL <tt>insert</tt>.
    */
   virtual long long insertedId() = 0;
@@ -144,6 +144,9 @@ private:
     int transactionCount_;
     std::vector<ptr_base *> objects_;
 
+    // the shared cache generation when the transaction started
+    long long cacheGeneration_;
+
     std::unique_ptr<SqlConnection> connection_;
 
     void open();
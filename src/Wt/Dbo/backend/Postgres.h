@@ -14,6 +14,8 @@
 #include <Wt/Dbo/backend/WDboPostgresDllDefs.h>
 
 #include <chrono>
+#include <functional>
+#include <vector>
 
 struct pg_conn;
 typedef struct pg_conn PGconn;
@@ -127,11 +129,91 @@ public:
    */
   void setMaximumLifetime(std::chrono::seconds seconds);
 
+  /*! \brief Sets the number of rows fetched at once for streamed queries.
+   *
+   * By default, the entire result of a query is retrieved from the
+   * server (and kept in memory by libpq) before the first row is
+   * returned. When a fetch size > 0 is set, a select statement that
+   * is executed within a transaction instead declares a server-side
+   * cursor, from which rows are fetched in batches of \p rows as
+   * they are being consumed.
+   *
+   * This lets you iterate a Wt::Dbo::collection over a very large
+   * result in constant memory, and returns the first row as soon as
+   * the first batch is available. The collection must then be
+   * iterated within the transaction in which it was queried, since
+   * the cursor is closed when the transaction ends.
+   *
+   * A cursor is declared with the SQL of the query rather than from
+   * its prepared statement, and thus the query is parsed and planned
+   * again for every execution. Therefore, streaming pays off for large
+   * results, but makes a frequently executed small query slower.
+   *
+   * The default value is 0 (results are not streamed).
+   */
+  void setFetchSize(int rows);
+
+  /*! \brief Returns the number of rows fetched at once for streamed queries.
+   *
+   * \sa setFetchSize()
+   */
+  int fetchSize() const { return fetchSize_; }
+
+  /*! \brief Sets whether query results are transferred in binary format.
+   *
+   * By default, results are transferred in text format and parsed
+   * into the requested value. When enabled, prepared statements of
+   * which all result columns have a type that can be decoded
+   * directly (boolean, smallint, integer, bigint, real, double
+   * precision, the character types, bytea, date, timestamp [with time
+   * zone], interval and uuid) instead request the results in binary
+   * format, avoiding the conversion to and from text. Other
+   * statements still use text format.
+   *
+   * Binary format requires a server that uses integer date/time
+   * storage (the default since PostgreSQL 8.4).
+   *
+   * The default value is false.
+   */
+  void setBinaryResultFormat(bool enabled);
+
+  /*! \brief Returns whether query results are transferred in binary format.
+   *
+   * \sa setBinaryResultFormat()
+   */
+  bool binaryResultFormat() const { return binaryResultFormat_; }
+
+  /*! \brief Sets whether statements are batched using pipeline mode.
+   *
+   * When enabled, statements of which the result is not needed right
+   * away (updates, deletes and inserts without an auto-incremented
+   * id, as issued by Session::flush()) are sent using libpq's
+   * pipeline mode, without waiting for each result. The results are
+   * collected when the session has been flushed, or before another
+   * statement is executed, saving a network round trip per
+   * statement. Version conflicts (StaleObjectException) and other
+   * errors are still detected for each statement, but are reported
+   * when the results are collected. Until then, a saved object remains
+   * dirty (see ptr::isDirty()).
+   *
+   * This requires libpq 14 or later, and has no effect otherwise.
+   *
+   * The default value is false.
+   */
+  void setPipelineMode(bool enabled);
+
+  /*! \brief Returns whether statements are batched using pipeline mode.
+   *
+   * \sa setPipelineMode()
+   */
+  bool pipelineMode() const { return pipelineMode_; }
+
   virtual void executeSql(const std::string &sql) override;
 
   virtual void startTransaction() override;
   virtual void commitTransaction() override;
   virtual void rollbackTransaction() override;
+  virtual void completeDeferred() override;
 
   virtual std::unique_ptr<SqlStatement> prepareStatement(const std::string& sql) override;
 
@@ -162,8 +244,19 @@ private:
   std::chrono::microseconds timeout_;
   std::chrono::seconds maximumLifetime_;
   std::chrono::steady_clock::time_point connectTime_;
+  int fetchSize_;
+  bool binaryResultFormat_;
+  bool pipelineMode_;
+  unsigned transactionSerial_;
+
+  // completion functions for statements sent in pipeline mode
+  std::vector<std::function<void (int)> > deferred_;
 
   void exec(const std::string& sql, bool showQuery);
+  void collectDeferred(bool complete);
+  void waitForResult(std::chrono::steady_clock::time_point deadline);
+
+  friend class PostgresStatement;
 };
 
     }
@@ -51,6 +51,12 @@ namespace Wt {
    * Otherwise, when involved in a Many-to-One or Many-to-Many
    * relation, you may also insert() and erase() objects in it.
    *
+   * The results of a query are read from the database while
+   * iterating. With most backends, the entire result is however
+   * retrieved from the server when the query is executed. The
+   * PostgreSQL backend can instead stream the results in batches,
+   * see backend::Postgres::setFetchSize().
+   *
    * You will typically iterate the container results for local
    * processing, or copy the results into a standard STL container for
    * extended processing. Not only the weak guarantees of the
@@ -410,6 +416,7 @@ namespace Wt {
       SqlStatement *statement, *countStatement;
       int size;
       int useCount;
+      bool executed; // by executeAsync()
     };
 
     union {
@@ -427,6 +434,7 @@ namespace Wt {
     friend class TransactionDoneAction;
     template <class D> friend class weak_ptr;
     template <class Result, typename BindStrategy> friend class Query;
+    template <class Result> friend class Impl::QueryBase;
 
     collection(Session *session, SqlStatement *selectStatement,
 	       SqlStatement *countStatement);
@@ -438,6 +446,9 @@ namespace Wt {
     void releaseQuery();
 
     SqlStatement *executeStatement() const;
+    void executeAsync(const std::function<void (std::exception_ptr,
+						collection<C>)>& callback)
+      const;
 
     void iterateDone() const;
   };
@@ -308,6 +308,7 @@ collection<C>::collection(Session *session, SqlStatement *statement,
   data_.query->statement = statement;
   data_.query->countStatement = countStatement;
   data_.query->size = -1;
+  data_.query->executed = false;
 }
 
 template <class C>
@@ -421,6 +422,11 @@ SqlStatement *collection<C>::executeStatement() const
 {
   SqlStatement *statement = nullptr;
 
+  if (type_ == QueryCollection && data_.query->executed) {
+    data_.query->executed = false;
+    return data_.query->statement;
+  }
+
   if (session_ && session_->flushMode() == FlushMode::Auto)
     session_->flush();
 
@@ -440,6 +446,34 @@ SqlStatement *collection<C>::executeStatement() const
   return statement;
 }
 
+template <class C>
+void collection<C>::executeAsync
+  (const std::function<void (std::exception_ptr, collection<C>)>& callback)
+  const
+{
+  if (type_ != QueryCollection || !data_.query->statement) {
+    callback(nullptr, *this);
+    return;
+  }
+
+  try {
+    if (session_ && session_->flushMode() == FlushMode::Auto)
+      session_->flush();
+  } catch (...) {
+    callback(std::current_exception(), *this);
+    return;
+  }
+
+  collection<C> self(*this);
+  data_.query->statement->executeAsync
+    (session_->asyncSocketWait(),
+     [self, callback](std::exception_ptr error) {
+      if (!error)
+	self.data_.query->executed = true;
+      callback(error, self);
+    });
+}
+
 template <class C>
 typename collection<C>::iterator collection<C>::begin()
 {
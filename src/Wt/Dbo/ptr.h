@@ -78,8 +78,10 @@ public:
 
     DeletedInTransaction = 0x100,
     SavedInTransaction = 0x200,
+    SavePending = 0x400, // the result of the save is deferred
 
-    TransactionState = (SavedInTransaction | DeletedInTransaction)
+    TransactionState = (SavedInTransaction | DeletedInTransaction
+			| SavePending)
   };
 
   MetaDboBase(int version, int state, Session *session)
@@ -116,7 +118,7 @@ public:
   bool isDeleted() const
     { return 0 != (state_ & (NeedsDelete | DeletedInTransaction)); }
 
-  bool isDirty() const { return 0 != (state_ & NeedsSave); }
+  bool isDirty() const { return 0 != (state_ & (NeedsSave | SavePending)); }
   bool inTransaction() const { return 0 != (state_ & 0xF00); }
 
   bool savedInTransaction() const
@@ -131,6 +133,7 @@ public:
 
   void setTransactionState(State state);
   void resetTransactionState();
+  void saveCompleted();
 
   void incRef();
   void decRef();
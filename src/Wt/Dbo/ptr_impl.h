@@ -201,6 +201,7 @@ void MetaDbo<C>::reread()
   checkNotOrphaned();
   if (isPersisted()) {
     session()->discardChanges(this);
+    session()->invalidateShared(session()->template tableName<C>(), idStr());
 
     delete obj_;
     obj_ = nullptr;
@@ -79,6 +79,22 @@ public:
    */
   void schedule(std::chrono::steady_clock::duration millis, const std::function<void()>& function);
 
+  /*! \brief Calls a function when a socket is readable.
+   *
+   * Registers the (non-owned) \p socket with the reactor, and calls
+   * \p function within a thread of the thread-pool with \c true once
+   * data can be read from it. If this did not happen within \p
+   * timeout (unless it is zero), or the wait was cancelled, \p function
+   * is called with \c false instead. This method returns immediately.
+   *
+   * This can be used to wait for the result of a database query
+   * without blocking a thread, see Wt::Dbo::Session::setAsyncSocketWait().
+   * Since \p function is not called within a session, use
+   * WServer::post() to continue within the session that waits.
+   */
+  void waitReadable(int socket, std::chrono::steady_clock::duration timeout,
+		    const std::function<void (bool)>& function);
+
   /*! \brief Initializes a thread.
    *
    * This function is called for every new thread created, and can be used
@@ -101,6 +117,11 @@ private:
   void handleTimeout(const std::shared_ptr<AsioWrapper::asio::steady_timer>& timer,
 		     const std::function<void ()>& function,
 		     const AsioWrapper::error_code& e);
+  struct SocketWait;
+  void handleReadable(const std::shared_ptr<SocketWait>& wait,
+		      const AsioWrapper::error_code& e);
+  void handleWaitTimeout(const std::shared_ptr<SocketWait>& wait,
+			 const AsioWrapper::error_code& e);
   void run();
 };
 
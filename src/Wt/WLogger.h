@@ -176,6 +176,73 @@ public:
    */
   void setFile(const std::string& path);
 
+  /*! \brief What happens to a line that is logged while the queue is
+   *         full.
+   *
+   * \sa setAsync()
+   */
+  enum class OverflowPolicy {
+    Block, //!< Wait until the writer has made room in the queue
+    Drop,  //!< Drop the line
+    Report //!< Drop the line, and log how many lines were dropped
+  };
+
+  /*! \brief Writes log lines asynchronously.
+   *
+   * By default, a line is written to the output stream, and flushed,
+   * by the thread that logs it. In asynchronous mode, lines are
+   * queued instead, and a background thread writes them in batches,
+   * with a single write and flush for each batch.
+   *
+   * At most \p queueSize lines are queued: the \p policy decides what
+   * happens with a line that is logged while the queue is full.
+   *
+   * A \p queueSize of 0 switches back to synchronous logging, after
+   * the queued lines have been written.
+   *
+   * Asynchronous logging requires a build with thread support:
+   * otherwise, lines are always written synchronously.
+   *
+   * \sa flush()
+   */
+  void setAsync(std::size_t queueSize,
+		OverflowPolicy policy = OverflowPolicy::Block);
+
+  /*! \brief Returns whether lines are written asynchronously.
+   *
+   * \sa setAsync()
+   */
+  bool isAsync() const;
+
+  /*! \brief Returns the number of lines that were dropped.
+   *
+   * Lines are dropped when the queue of an asynchronous logger is
+   * full, unless the overflow policy is OverflowPolicy::Block.
+   */
+  long long droppedLines() const;
+
+  /*! \brief Waits until all lines are written.
+   *
+   * In asynchronous mode, this waits until the background thread has
+   * written all queued lines.
+   */
+  void flush();
+
+  /*! \brief Rotates the log file when it grows too large.
+   *
+   * When the file that was set with setFile() exceeds \p maxSize
+   * bytes, it is renamed to <i>path</i>.1 (and a previous
+   * <i>path</i>.1 to <i>path</i>.2, up to \p maxFiles old files),
+   * and a new file is opened. When \p maxFiles is 0, the file is
+   * truncated instead.
+   *
+   * Rotation is done by the thread that writes the lines, i.e. by the
+   * background thread in asynchronous mode.
+   *
+   * A \p maxSize of 0 disables rotation, which is the default.
+   */
+  void setRotation(std::size_t maxSize, int maxFiles);
+
   /*! \brief Configures what things are logged.
    *
    * The configuration is a string that defines rules for enabling or
@@ -260,8 +327,12 @@ public:
 private:
   std::ostream* o_;
   bool ownStream_;
+  std::string path_;
   std::vector<Field> fields_;
 
+  struct Writer;
+  std::unique_ptr<Writer> writer_;
+
   struct Rule {
     bool include;
     std::string type;
@@ -272,6 +343,10 @@ private:
 
   void addLine(const std::string& type, const std::string& scope,
 	       const WStringStream& s) const;
+  void write(const std::string& lines) const;
+  void rotate() const;
+  void runWriter();
+  void stopWriter();
 
   friend class WLogEntry;
 };
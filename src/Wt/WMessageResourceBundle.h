@@ -7,6 +7,8 @@
 #ifndef WMESSAGE_RESOURCE_BUNDLE_
 #define WMESSAGE_RESOURCE_BUNDLE_
 
+#include <atomic>
+#include <chrono>
 #include <vector>
 #include <set>
 #include <Wt/WFlags.h>
@@ -112,6 +114,21 @@ class WMessageResources;
  * To message defined in this resource file can then be used using
  * WString::trn("file", n).
  *
+ * <h3>Sharing a bundle between sessions</h3>
+ *
+ * A bundle may be shared by all sessions of a server, e.g. by passing
+ * it to WServer::setLocalizedStrings(). Resolving a key does not take
+ * any lock: each resource file is loaded once, and the loaded
+ * resources are published as immutable snapshots. You may preload()
+ * all locales at startup, to avoid loading files while serving
+ * requests, and refresh() the bundle (or configure a
+ * setRefreshInterval()) to pick up changes to the resource files
+ * without restarting the server.
+ *
+ * The resource files that exist (and thus the locales for which
+ * messages are available) are listed when the bundle is first used. A
+ * file for a new locale, added later, is only picked up by refresh().
+ *
  * \sa WApplication::locale(), WString::tr(), WString::trn()
  */
 class WT_API WMessageResourceBundle : public WLocalizedStrings
@@ -154,6 +171,48 @@ public:
    */
   const std::set<std::string> keys(const WLocale& locale) const;
 
+  /*! \brief Loads all resource files.
+   *
+   * Loads the resource files for the default locale, and for all
+   * locales for which a resource file is found next to it (e.g. for
+   * /path/to/name, all /path/to/name_<i>locale</i>.xml files).
+   * Otherwise, a resource file is loaded when it is first used.
+   */
+  void preload();
+
+  /*! \brief Reloads the resource files that changed.
+   *
+   * Compares the modification time of each loaded resource file,
+   * and reloads the files that have been modified. It also lists the
+   * resource files again, so that files added for a new locale are
+   * found. The new messages replace the old messages atomically:
+   * concurrent lookups see either the old or the new messages of a
+   * file.
+   *
+   * Returns whether a resource file was reloaded.
+   *
+   * \sa setRefreshInterval()
+   */
+  bool refresh();
+
+  /*! \brief Sets an interval to check for changed resource files.
+   *
+   * When set, resolving a key calls refresh() if the interval has
+   * passed since the previous check (in only one thread, other threads
+   * keep using the current messages).
+   *
+   * The default value is zero, which disables automatic checks.
+   */
+  void setRefreshInterval(std::chrono::steady_clock::duration interval);
+
+  /*! \brief Returns the interval to check for changed resource files.
+   *
+   * \sa setRefreshInterval()
+   */
+  std::chrono::steady_clock::duration refreshInterval() const {
+    return refreshInterval_.load(std::memory_order_relaxed);
+  }
+
   virtual void hibernate() override;
 
   virtual LocalizedString resolveKey(const WLocale& locale, const std::string& key) override;
@@ -163,6 +222,10 @@ public:
 
 private:
   std::vector<std::unique_ptr<WMessageResources> > messageResources_;
+  std::atomic<std::chrono::steady_clock::duration> refreshInterval_;
+  std::atomic<long long> nextRefresh_;
+
+  void checkRefresh();
 };
 
 }
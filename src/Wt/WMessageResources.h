@@ -7,10 +7,13 @@
 #ifndef WMESSAGE_RESOURCES_
 #define WMESSAGE_RESOURCES_
 
+#include <ctime>
+#include <memory>
 #include <string>
 #include <vector>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <Wt/WFlags.h>
 #include <Wt/WMessageResourceBundle.h>
 #include <Wt/WDllDefs.h>
@@ -43,32 +46,74 @@ public:
 
   std::set<std::string> keys(const WLocale& locale) const;
 
+  void preload();
+  bool refresh();
+
 private:
-  typedef std::map<std::string, std::vector<std::string> > KeyValuesMap;
+  typedef std::unordered_map<std::string, std::vector<std::string> >
+    KeyValuesMap;
 
   struct Resource {
     KeyValuesMap map_;
     std::string pluralExpression_;
     unsigned pluralCount_;
+
+    // the file that was read, and its modification time
+    std::string fileName_;
+    std::time_t modified_;
+
+    Resource();
   };
 
-  typedef std::map<std::string, Resource> ResourceMap;
+  /*
+   * An immutable snapshot of the loaded resources. Loading or
+   * reloading a locale publishes a new snapshot, so that readers do
+   * not need to lock: a reader keeps the snapshot it uses alive.
+   *
+   * Only locales for which a file exists are loaded: a requested
+   * locale is reduced to the most specific of those (locales_), so
+   * that arbitrary locale names (from Accept-Language) do not add
+   * entries.
+   */
+  struct Store {
+    bool listed_;
+    std::set<std::string> locales_;
+    std::unordered_map<std::string, std::shared_ptr<const Resource> >
+      resources_;
+
+    Store();
+
+    bool match(std::string& locale) const;
+  };
 
   bool loadInMemory_;
   std::string path_;
   const char *builtin_;
+
 #ifdef WT_THREADED
-  std::mutex resourceMutex_;
+  // serializes publishing a new snapshot
+  mutable std::mutex resourceMutex_;
 #endif
-  mutable ResourceMap resources_;
 
-  void load(const WLocale& locale) const;
+  mutable std::shared_ptr<const Store> store_;
+
+  std::shared_ptr<const Store> store() const;
+  void publish(std::shared_ptr<const Store> store) const;
+
+  std::shared_ptr<const Resource> resource(const std::string& locale) const;
+  std::shared_ptr<const Resource> load(const std::string& locale) const;
+  std::shared_ptr<Resource> readResource(const std::string& locale,
+					 std::vector<std::string>& errors)
+    const;
+  void listLocales(Store& store, std::vector<std::string>& errors) const;
+  void logErrors(const std::vector<std::string>& errors) const;
   LocalizedString resolve(const std::string& locale, const std::string& key) const;
   LocalizedString resolvePlural(const std::string& locale, const std::string& key, ::uint64_t amount) const;
-  bool readResourceFile(const std::string& locale, Resource& resource) const;
+  bool readResourceFile(const std::string& locale, Resource& resource,
+			std::vector<std::string>& errors) const;
   bool readResourceStream(std::istream &s, Resource& resource,
-                          const std::string &fileName) const;
-
+                          const std::string &fileName,
+			  std::vector<std::string>& errors) const;
   std::string findCase(const std::vector<std::string> &cases,
 		       std::string pluralExpression,
 		       ::uint64_t amount) const;
@@ -9,6 +9,7 @@
 #define WRANDOM_H_
 
 #include <Wt/WDllDefs.h>
+#include <cstddef>
 #include <string>
 
 namespace Wt {
@@ -19,6 +20,10 @@ namespace Wt {
  * If an implementation is available for your OS, this class generates
  * high-entropy random numbers, suitable for secret ids (e.g. this is
  * used to generate %Wt's session IDs).
+ *
+ * Numbers are produced by a ChaCha20 based generator for each thread,
+ * which is seeded from the operating system's random source, and
+ * reseeded regularly and in a child process after a fork().
  */
 class WT_API WRandom
 {
@@ -31,6 +36,16 @@ public:
    */
   static unsigned int get();
 
+#ifndef WT_TARGET_JAVA
+  /*! \brief Fills a buffer with random bytes.
+   *
+   * This is more efficient than repeatedly calling get().
+   *
+   * \sa get()
+   */
+  static void fill(unsigned char *buffer, std::size_t size);
+#endif // WT_TARGET_JAVA
+
   /*! \brief A utility method to generate a random id.
    *
    * The id is composed of small and capitalized roman characters and
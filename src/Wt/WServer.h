@@ -103,6 +103,14 @@ public:
   {
     int64_t     processId; //!< The process id of the process the session is running in.
     std::string sessionId; //!< The session id.
+    /*! \brief The heap memory held by the session (bytes).
+     *
+     * This is only available with the wthttp connector, in a build
+     * with ENABLE_MEMORY_ACCOUNTING, for sessions that run in this
+     * process. It is -1 otherwise, in particular for sessions that run
+     * in a dedicated process.
+     */
+    long long   memoryUsage;
   };
 #endif // WT_TARGET_JAVA
 
@@ -543,12 +551,14 @@ public:
 
   /*! \brief Retrieve information on all sessions.
    *
-   * This is only implemented for the wthttp connector.
+   * This is only implemented for the wthttp connector: the list is
+   * empty for the FastCGI and ISAPI connectors.
    *
    * If the dedicated process session policy is used, only the original
    * process has access to the full list of sessions. Public resources
    * (those registered with addResource()) run in the original process,
-   * so they can access this list.
+   * so they can access this list. The memory usage of such sessions
+   * is not available (SessionInfo::memoryUsage is -1).
    */
   WTCONNECTOR_API std::vector<SessionInfo> sessions() const;
 
@@ -343,6 +343,20 @@ private:
     Item *item;
   };
 
+#ifndef WT_TARGET_JAVA
+  /*
+   * The sort data of a row, extracted once while sorting, so that
+   * comparisons do not need to fetch (and convert) the data again.
+   */
+  struct SortKey;
+  struct SortKeys;
+
+  mutable SortKeys *sortKeys_;
+
+  bool isSortKeyIndex(const WModelIndex& index) const;
+  const SortKey& sortKey(const WModelIndex& index) const;
+#endif // WT_TARGET_JAVA
+
   std::unique_ptr<std::regex> regex_;
   int filterKeyColumn_;
   ItemDataRole filterRole_;
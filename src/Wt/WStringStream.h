@@ -199,6 +199,14 @@ public:
    */
   void clear();
 
+  /*! \brief Moves the contents of another stream to the end.
+   *
+   * The buffers of \p other are taken over rather than copied (except
+   * for its small internal buffer), and \p other is left empty. If
+   * this stream has a sink, the contents are written to the sink.
+   */
+  void splice(WStringStream& other);
+
   // no-op for C++, but needed for Java
   void spool(std::ostream& ) { }
 
@@ -223,6 +231,7 @@ private:
 
   void flushSink();
   void pushBuf();
+  void spliceBuf(WStringStream& other, char *buf, int length);
 };
 
 #ifdef WT_DBO_STRINGSTREAM
@@ -79,6 +79,10 @@ namespace Wt {
  * a layout manager or by setHeight()), then it will grow according
  * to the size of the model.
  *
+ * For large tables, you may enable client-side rendering (see
+ * setClientSideRendering()), which renders plain cells in the browser
+ * instead of creating a widget for each cell.
+ *
  * \ingroup modelview
  */
 class WT_API WTableView : public WAbstractItemView
@@ -148,6 +152,38 @@ public:
    */
   WLength preloadMargin(Side side) const;
 
+  /*! \brief Enables client-side rendering of cells.
+   *
+   * By default, the view creates a widget for each rendered cell,
+   * using the item delegate. With client-side rendering, cells that
+   * are rendered by the default WItemDelegate are instead sent to the
+   * browser as compact row data, and the browser creates the cells.
+   * This saves server-side memory and CPU time, and reduces the size
+   * of the response when scrolling through a table with many
+   * columns.
+   *
+   * A client-side rendered cell shows the text (using the delegate's
+   * WItemDelegate::textFormat()), the tool tip and the style class of
+   * the item, and reflects its selection state. Check boxes, icons
+   * and links are not rendered, and the cell cannot be edited.
+   * Columns for which a delegate was set using
+   * setItemDelegateForColumn(), or all columns if a custom item
+   * delegate was set using setItemDelegate(), are rendered using
+   * widgets as before. To keep using widgets for a column that
+   * needs them, set a WItemDelegate for that column.
+   *
+   * Client-side rendering is only used when JavaScript is available.
+   *
+   * The default value is \c false.
+   */
+  void setClientSideRendering(bool enabled);
+
+  /*! \brief Returns whether client-side rendering is enabled.
+   *
+   * \sa setClientSideRendering()
+   */
+  bool clientSideRendering() const { return clientSideRendering_; }
+
   virtual void setHidden(bool hidden,
 			 const WAnimation& animation = WAnimation()) override;
 
@@ -182,13 +218,26 @@ private:
   {
   public:
     int column() const { return column_; }
+    bool clientRendered() const { return clientRendered_; }
 
   private:
-    ColumnWidget(int column);
+    /* A pending update of client-side rendered cells */
+    struct CellOp {
+      enum Type { Remove, Insert, Update };
+
+      Type type;
+      int pos;   // -1 is after the last cell
+      int count; // -1 is all cells
+      std::string cells;
+    };
+
+    ColumnWidget(int column, bool clientRendered);
 
     int column_;
+    bool clientRendered_;
+    std::vector<CellOp> cellOps_;
 
-    friend ColumnWidget *WTableView::createColumnWidget(int column);
+    friend class WTableView;
   };
 
   /* For Ajax implementation */
@@ -227,6 +276,8 @@ private:
   /* Scroll to to process after viewport height is known */
   int scrollToRow_;
   ScrollHint scrollToHint_;
+
+  bool clientSideRendering_;
   bool columnResizeConnected_;
 
   void updateTableBackground();
@@ -318,6 +369,14 @@ private:
 
   void deleteItem(int row, int col, WWidget *widget);
 
+  bool isClientRendered(int column) const;
+  std::string renderCell(const WModelIndex& index) const;
+  void removeCells(ColumnWidget *column, int pos, int count);
+  void insertCell(ColumnWidget *column, int pos, const WModelIndex& index);
+  void updateCell(ColumnWidget *column, int pos, const WModelIndex& index);
+  void resendCells();
+  void flushCells();
+
   bool ajaxMode() const { return table_ != nullptr; }
   double canvasHeight() const;
   void setRenderedHeight(double th);
@@ -761,7 +761,9 @@ public:
   /*! \brief Renders a template into the given result stream.
    *
    * The default implementation will parse the template, and resolve variables
-   * by calling resolveString().
+   * by calling resolveString(). The parsed form of a localized template
+   * text is cached, and shared by all templates that render the same
+   * text in the same locale.
    *
    * You may want to reimplement this method to manage resources that are
    * needed to load content on-demand (e.g. database objects), or support
@@ -844,6 +846,16 @@ private:
   TemplateWidgetIdMode widgetIdMode_;
 
   std::string encode(const std::string& text) const;
+
+#ifndef WT_TARGET_JAVA
+  struct Program;
+
+  std::shared_ptr<const Program> program(const WString& templateText,
+					 const std::string& text) const;
+  static std::shared_ptr<const Program> compile(const std::string& text);
+  bool renderProgram(std::ostream& result, const Program& program);
+#endif // WT_TARGET_JAVA
+
   static std::size_t parseArgs(const std::string& text,
 			       std::size_t pos,
 			       std::vector<WString>& result);
@@ -80,11 +80,20 @@ public:
 
   const std::string& sessionIdPrefix() const { return sessionIdPrefix_; }
   const std::string& accessLog() const { return accessLog_; }
+  int accessLogQueueSize() const { return accessLogQueueSize_; }
+  const std::string& accessLogOverflow() const { return accessLogOverflow_; }
+  ::int64_t accessLogRotateSize() const { return accessLogRotateSize_; }
+  int accessLogRotateFiles() const { return accessLogRotateFiles_; }
 
   int parentPort() const { return parentPort_; }
 
   ::int64_t maxMemoryRequestSize() const { return maxMemoryRequestSize_; }
 
+  ::int64_t staticCacheSize() const { return staticCacheSize_; }
+  ::int64_t staticCacheMaxFileSize() const { return staticCacheMaxFileSize_; }
+  int staticCacheRevalidate() const { return staticCacheRevalidate_; }
+  ::int64_t sendFileThreshold() const { return sendFileThreshold_; }
+
   typedef std::function<std::string (std::size_t max_length, int purpose)>
     SslPasswordCallback;
 
@@ -133,11 +142,20 @@ private:
 
   std::string sessionIdPrefix_;
   std::string accessLog_;
+  int accessLogQueueSize_;
+  std::string accessLogOverflow_;
+  ::int64_t accessLogRotateSize_;
+  int accessLogRotateFiles_;
 
   int parentPort_;
 
   ::int64_t maxMemoryRequestSize_;
 
+  ::int64_t staticCacheSize_;
+  ::int64_t staticCacheMaxFileSize_;
+  int staticCacheRevalidate_;
+  ::int64_t sendFileThreshold_;
+
   SslPasswordCallback sslPasswordCallback_;
 
   void createOptions(po::options_description& options,
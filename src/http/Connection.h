@@ -59,6 +59,9 @@ public:
   /// Like CGI's Url scheme: http or https
   virtual const char *urlScheme() = 0;
 
+  /// Whether a reply may provide file regions (see Reply::nextFileRegion())
+  virtual bool sendFileSupported() const { return false; }
+
   virtual ~Connection();
 
   Server *server() const { return server_; }
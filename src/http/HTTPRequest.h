@@ -30,6 +30,8 @@ public:
 
   virtual std::istream& in() override { return reply_->in(); }
   virtual std::ostream& out() override { return reply_->out(); }
+  virtual void spool(Wt::WStringStream& stream) override
+    { reply_->spool(stream); }
   virtual std::ostream& err() override { return std::cerr; }
 
   virtual void setStatus(int status) override;
@@ -57,6 +59,9 @@ public:
   virtual std::unique_ptr<Wt::WSslInfo> sslInfo(const Wt::Configuration & conf) const override;
   virtual const std::vector<std::pair<std::string, std::string> > &urlParams() const override;
 
+protected:
+  virtual Wt::MultipartParser *parsedMultipart() override;
+
 private:
   WtReplyPtr reply_;
   mutable std::string serverPort_;
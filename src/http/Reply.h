@@ -117,9 +117,21 @@ public:
 				       const char* end,
 				       Request::State state);
 
+  /*
+   * A region of an open file, to be transmitted by the connection
+   * directly from the file (using sendfile()), after the buffers
+   * returned by the last call to nextBuffers().
+   */
+  struct FileRegion {
+    int fd;
+    ::int64_t offset;
+    ::int64_t size;
+  };
+
   void setConnection(ConnectionPtr connection);
   bool nextWrappedContentBuffers(std::vector<asio::const_buffer>& result);
   bool nextBuffers(std::vector<asio::const_buffer>& result);
+  bool nextFileRegion(FileRegion& result);
   bool closeConnection() const;
   void setCloseConnection() { closeConnection_ = true; }
   void detectDisconnect(const std::function<void()>& callback);
@@ -136,6 +148,8 @@ public:
   void setStatus(status_type status);
   status_type status() const { return status_; }
 
+  static std::string httpDate(time_t t);
+
 protected:
   Request& request_;
   const Configuration& configuration_;
@@ -151,11 +165,16 @@ protected:
   virtual bool nextContentBuffers(std::vector<asio::const_buffer>& result)
     = 0;
 
+  /*
+   * Provides a file region to send after the buffers of the last call to
+   * nextContentBuffers(). Only called for connections that support
+   * sendfile(), and only used when the reply has a known content length.
+   */
+  virtual bool nextContentFileRegion(FileRegion& result);
+
   void setRelay(ReplyPtr reply);
   ReplyPtr relay() const { return relay_; }
 
-  static std::string httpDate(time_t t);
-
   ConnectionPtr connection() const { return connection_; }
   bool transmitting() const { return transmitting_; }
   asio::const_buffer buf(const std::string &s);
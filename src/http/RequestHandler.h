@@ -23,6 +23,7 @@
 
 #include "Configuration.h"
 #include "SessionProcessManager.h"
+#include "StaticFileCache.h"
 #include "WtReply.h"
 #include "../web/Configuration.h"
 
@@ -67,6 +68,8 @@ private:
   Wt::WLogger& logger_;
   /// The session manager for dedicated processes
   SessionProcessManager *sessionManager_;
+  /// The in-memory cache of static files
+  StaticFileCache staticCache_;
 
   /// Perform URL-decoding on a string and separates in path and
   /// query. Returns false if the encoding was invalid.
@@ -0,0 +1,117 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2008 Emweb bv, Herent, Belgium.
+ *
+ * All rights reserved.
+ */
+
+#ifndef HTTP_STATIC_FILE_CACHE_HPP
+#define HTTP_STATIC_FILE_CACHE_HPP
+
+#include <chrono>
+#include <ctime>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "Wt/WConfig.h"
+
+#ifdef WT_THREADED
+#include <mutex>
+#endif // WT_THREADED
+
+#include <boost/cstdint.hpp>
+
+// For ::int64_t and ::uint64_t on Windows only
+#include "Wt/WDllDefs.h"
+
+namespace http {
+namespace server {
+
+class Configuration;
+
+/// Bounded in-memory cache of small static files.
+/*
+ * Each entry holds the file contents together with the values of the
+ * headers that StaticReply derives from it (ETag, Last-Modified), and a
+ * gzip variant: either the contents of a ".gz" file next to it, or, if
+ * compression is enabled, the contents compressed once when loaded.
+ *
+ * An entry is revalidated (a single stat()) when it is looked up after
+ * the configured revalidation interval, and reloaded when the
+ * modification time or size of the file changed. The least recently
+ * used entries are evicted when the total size exceeds the configured
+ * maximum.
+ */
+class StaticFileCache
+{
+public:
+  struct Entry {
+    std::string data;
+    std::string etag;
+
+    /// Empty if there is no gzip variant
+    std::string gzipData;
+    std::string gzipEtag;
+
+    std::string modifiedDate;
+
+    std::time_t modified;
+    ::int64_t fileSize;
+  };
+
+  typedef std::shared_ptr<const Entry> EntryPtr;
+
+  explicit StaticFileCache(const Configuration& config);
+
+  StaticFileCache(const StaticFileCache&) = delete;
+  StaticFileCache& operator=(const StaticFileCache&) = delete;
+
+  bool enabled() const;
+
+  /// Returns the cache entry for a file.
+  /*
+   * Returns nullptr if the file does not exist, or is not eligible
+   * for caching (e.g. because it is too large).
+   */
+  EntryPtr get(const std::string& path, const std::string& contentType);
+
+  /// Removes all entries.
+  void clear();
+
+private:
+  typedef std::chrono::steady_clock::time_point TimePoint;
+
+  struct Slot {
+    EntryPtr entry;
+    TimePoint validated;
+    std::list<std::string>::iterator lruPos;
+  };
+
+  const Configuration& config_;
+
+#ifdef WT_THREADED
+  std::mutex mutex_;
+#endif // WT_THREADED
+
+  std::unordered_map<std::string, Slot> entries_;
+  std::list<std::string> lru_; // most recently used first
+  ::int64_t size_;
+
+  EntryPtr load(const std::string& path, const std::string& contentType,
+		std::time_t modified) const;
+  void insert(const std::string& path, const EntryPtr& entry,
+	      const TimePoint& now);
+  void remove(std::unordered_map<std::string, Slot>::iterator i);
+
+  static ::int64_t entrySize(const Entry& entry);
+  static bool readFile(const std::string& path, std::string& result,
+		       ::int64_t maxSize);
+  static bool isCompressible(const std::string& contentType);
+};
+
+} // namespace server
+} // namespace http
+
+#endif // HTTP_STATIC_FILE_CACHE_HPP
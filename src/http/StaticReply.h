@@ -22,6 +22,7 @@
 #include <fstream>
 
 #include "Reply.h"
+#include "StaticFileCache.h"
 
 namespace http {
 namespace server {
@@ -32,7 +33,9 @@ class Request;
 class StaticReply final : public Reply
 {
 public:
-  StaticReply(Request& request, const Configuration& config);
+  StaticReply(Request& request, const Configuration& config,
+	      StaticFileCache& cache);
+  virtual ~StaticReply();
 
   virtual void reset(const Wt::EntryPoint *ep) override;
   virtual void writeDone(bool success) override;
@@ -46,13 +49,26 @@ protected:
   virtual ::int64_t contentLength() override;
 
   virtual bool nextContentBuffers(std::vector<asio::const_buffer>& result) override;
+  virtual bool nextContentFileRegion(FileRegion& result) override;
 
 private:
+  StaticFileCache& cache_;
+
   std::string path_;
   std::string extension_;
   std::ifstream stream_;
   ::int64_t fileSize_;
 
+  // Set when the reply is served from the cache
+  StaticFileCache::EntryPtr cached_;
+  const std::string *cachedData_;
+
+  // Set when the reply is sent using sendfile()
+  int fd_;
+  bool sendFile_;
+
+  void closeFile();
+
   char buf_[64 * 1024];
 
   std::string computeModifiedDate() const;
@@ -42,6 +42,8 @@ public:
 
   virtual const char *urlScheme() override { return "http"; }
 
+  virtual bool sendFileSupported() const override;
+
 protected:
   virtual void startAsyncReadRequest(Buffer& buffer, int timeout) override;
   virtual void startAsyncReadBody(ReplyPtr reply, Buffer& buffer, int timeout) override;
@@ -51,6 +53,16 @@ protected:
 
   virtual void stop() override;
 
+  void handleWriteBuffers(ReplyPtr reply, int timeout,
+			  const Wt::AsioWrapper::error_code& e,
+			  std::size_t bytes_transferred);
+
+#ifdef __linux__
+  void sendFile(ReplyPtr reply, Reply::FileRegion region, int timeout,
+		std::size_t bytes_transferred,
+		const Wt::AsioWrapper::error_code& e);
+#endif // __linux__
+
   /// Socket for the connection.
   asio::ip::tcp::socket socket_;
 };
@@ -13,6 +13,8 @@
 #include <vector>
 
 #include "Reply.h"
+#include "Wt/WStringStream.h"
+#include "../web/CgiParser.h"
 #include "../web/Configuration.h"
 #include "../web/WebRequest.h"
 
@@ -30,6 +32,20 @@ class Configuration;
 
 typedef std::shared_ptr<WtReply> WtReplyPtr;
 
+/// A stream buffer that appends to a WStringStream
+class StringStreamBuf final : public std::streambuf
+{
+public:
+  StringStreamBuf(Wt::WStringStream& stream);
+
+protected:
+  virtual int_type overflow(int_type c) override;
+  virtual std::streamsize xsputn(const char *s, std::streamsize n) override;
+
+private:
+  Wt::WStringStream& stream_;
+};
+
 /// A Wt application reply to be sent to a client.
 class WtReply final : public Reply
 {
@@ -61,7 +77,9 @@ public:
   bool readAvailable();
 
   std::istream& in() { return *in_; }
+  Wt::MultipartParser *multipart() { return multipart_.get(); }
   std::ostream& out() { return out_; }
+  void spool(Wt::WStringStream& stream);
   Request& request() { return request_; }
   std::string urlScheme() const { return urlScheme_; }
 
@@ -70,7 +88,9 @@ protected:
   std::stringstream in_mem_;
   std::iostream *in_;
   std::string requestFileName_;
-  asio::streambuf out_buf_;
+  std::unique_ptr<Wt::MultipartParser> multipart_;
+  Wt::WStringStream outStream_, sendStream_;
+  StringStreamBuf out_buf_;
   std::ostream out_;
   std::string contentType_;
   std::string location_;
@@ -100,6 +120,7 @@ private:
   void consumeRequestBody(const char *begin,
 			  const char *end,
 			  Request::State state);
+  std::unique_ptr<Wt::MultipartParser> createMultipartParser();
   void formatResponse(std::vector<asio::const_buffer>& result);
 #ifdef WTHTTP_WITH_ZLIB
   int deflate(const unsigned char* in, size_t in_size, unsigned char out[], bool& hasMore);
@@ -301,6 +301,84 @@ WT_DECLARE_WT_MEMBER
      scrollY2 = Y2;
    };
 
+   function renderCell(cell, data, height) {
+     if (typeof data === 'string')
+       data = [data, '', '', 0];
+
+     var flags = data[3];
+
+     cell.className = 'Wt-tv-c' + (data[1] ? ' ' + data[1] : '')
+       + ((flags & 0x1) ? ' ' + selectedClass : '');
+     cell.style.height = height + 'px';
+
+     if (flags & 0x2)
+       cell.innerHTML = data[0];
+     else
+       cell.textContent = data[0];
+
+     if (data[2])
+       cell.title = data[2];
+     else
+       cell.removeAttribute('title');
+
+     if (flags & 0x4)
+       cell.setAttribute('drop', 'true');
+     else
+       cell.removeAttribute('drop');
+   }
+
+   /*
+    * Updates client-side rendered cells: columns is a list of
+    * [columnId, ops], where each op is one of:
+    *  [0, pos, count]: removes count cells (-1: all) at pos
+    *  [1, pos, cells]: inserts cells at pos
+    *  [2, pos, cell]: updates the cell at pos
+    * and a pos of -1 refers to the end of the column.
+    */
+   this.updateCells = function(columns, height) {
+     var i, j, k, column, ops, op, pos, cell;
+
+     for (i = 0; i < columns.length; ++i) {
+       column = document.getElementById(columns[i][0]);
+       if (!column)
+         continue;
+
+       ops = columns[i][1];
+       for (j = 0; j < ops.length; ++j) {
+         op = ops[j];
+         pos = op[1];
+
+         switch (op[0]) {
+         case 0:
+           if (op[2] < 0) {
+             while (column.lastChild)
+               column.removeChild(column.lastChild);
+           } else
+             for (k = 0; k < op[2]; ++k) {
+               cell = pos < 0 ? column.lastChild : column.childNodes[pos];
+               if (cell)
+                 column.removeChild(cell);
+             }
+           break;
+         case 1:
+           var cells = document.createDocumentFragment();
+           for (k = 0; k < op[2].length; ++k) {
+             cell = document.createElement('div');
+             renderCell(cell, op[2][k], height);
+             cells.appendChild(cell);
+           }
+           column.insertBefore(cells,
+                               pos < 0 ? null : column.childNodes[pos] || null);
+           break;
+         case 2:
+           cell = pos < 0 ? column.lastChild : column.childNodes[pos];
+           if (cell)
+             renderCell(cell, op[2], height);
+         }
+       }
+     }
+   };
+
    this.resetScroll = function() {
      headerContainer.scrollLeft = scrollLeft;
      contentsContainer.scrollLeft = scrollLeft;
@@ -4,7 +4,7 @@ $(document.body).hasClass("Wt-rtl");if(c)a=-a;var e=b.className.split(" ")[0],k=
 [[1,1]]);n;n=n.nextSibling)if(o){if(c)o.style.right=f.pxself(o,"right")+a+"px";else o.style.left=f.pxself(o,"left")+a+"px";o=o.nextSibling}p.emit(g,"columnResized",k,parseInt(u));U.autoJavaScript()}function J(b,a){p.emit(g,{name:"itemTouchSelectEvent",eventObject:b,event:a})}g.wtObj=this;var U=this,f=p.WT,P=$(document.body).hasClass("Wt-rtl"),C=0,D=0,A=0,B=0,y=0,K=F===0,v=0,q=0,M=0,N=0;this.onContentsContainerScroll=function(){q=l.scrollLeft=d.scrollLeft;v=r.scrollTop=d.scrollTop;Q()};d.wtResize=
 function(b,a,c){if(!K){b.scrollTop=F;b.onscroll();K=true}if(a-M>(D-C)/2||c-N>(B-A)/2){M=a;N=c;a=b.clientHeight==b.firstChild.offsetHeight?-1:b.clientHeight;p.emit(g,"scrolled",Math.round(H(b)),Math.round(b.scrollTop),Math.round(b.clientWidth),Math.round(a))}};var O=null;this.mouseDown=function(b,a){f.capture(null);var c=w(a);if(!a.ctrlKey&&!a.shiftKey){var e={ctrlKey:a.ctrlKey,shiftKey:a.shiftKey,target:a.target,srcElement:a.srcElement,type:a.type,which:a.which,touches:a.touches,changedTouches:a.changedTouches,
 pageX:a.pageX,pageY:a.pageY,clientX:a.clientX,clientY:a.clientY};O=setTimeout(function(){g.getAttribute("drag")==="true"&&S(c)&&p._p_.dragStart(g,e)},400)}};this.mouseUp=function(){clearTimeout(O)};this.resizeHandleMDown=function(b,a){var c=b.parentNode,e=-(f.pxself(c,"width")-1),k=1E4;if($(document.body).hasClass("Wt-rtl")){var h=e;e=-k;k=-h}new f.SizeHandle(f,"h",b.offsetWidth,g.offsetHeight,e,k,"Wt-hsh2",function(i){T(c,i)},b,g,a,-2,-1)};var s,E=0;this.touchStart=function(b,a){w(a);if(a.touches.length>
-1){clearTimeout(s);s=setTimeout(function(){J(b,a)},1E3);E=a.touches.length}else{clearTimeout(s);s=setTimeout(function(){J(b,a)},50);E=1}};this.touchMove=function(b,a){a.touches.length==1&&s&&clearTimeout(s)};this.touchEnd=function(){s&&E!=1&&clearTimeout(s)};this.scrolled=function(b,a,c,e){C=b;D=a;A=c;B=e};this.resetScroll=function(){l.scrollLeft=q;d.scrollLeft=q;d.scrollTop=v;r.scrollTop=v};this.setScrollToPending=function(){y+=1};this.scrollToPx=function(b,a){v=a;q=b;this.resetScroll()};this.scrollTo=
+1){clearTimeout(s);s=setTimeout(function(){J(b,a)},1E3);E=a.touches.length}else{clearTimeout(s);s=setTimeout(function(){J(b,a)},50);E=1}};this.touchMove=function(b,a){a.touches.length==1&&s&&clearTimeout(s)};this.touchEnd=function(){s&&E!=1&&clearTimeout(s)};this.scrolled=function(b,a,c,e){C=b;D=a;A=c;B=e};function Wc(b,a,c){if(typeof a==="string")a=[a,"","",0];var e=a[3];b.className="Wt-tv-c"+(a[1]?" "+a[1]:"")+(e&1?" "+G:"");b.style.height=c+"px";if(e&2)b.innerHTML=a[0];else b.textContent=a[0];if(a[2])b.title=a[2];else b.removeAttribute("title");if(e&4)b.setAttribute("drop","true");else b.removeAttribute("drop")}this.updateCells=function(b,a){var c,e,k,h,i,j,m,n;for(c=0;c<b.length;++c)if(h=document.getElementById(b[c][0])){i=b[c][1];for(e=0;e<i.length;++e){j=i[e];m=j[1];switch(j[0]){case 0:if(j[2]<0)for(;h.lastChild;)h.removeChild(h.lastChild);else for(k=0;k<j[2];++k)(n=m<0?h.lastChild:h.childNodes[m])&&h.removeChild(n);break;case 1:var o=document.createDocumentFragment();for(k=0;k<j[2].length;++k){n=document.createElement("div");Wc(n,j[2][k],a);o.appendChild(n)}h.insertBefore(o,m<0?null:h.childNodes[m]||null);break;case 2:(n=m<0?h.lastChild:h.childNodes[m])&&Wc(n,j[2],a)}}}};this.resetScroll=function(){l.scrollLeft=q;d.scrollLeft=q;d.scrollTop=v;r.scrollTop=v};this.setScrollToPending=function(){y+=1};this.scrollToPx=function(b,a){v=a;q=b;this.resetScroll()};this.scrollTo=
 function(b,a,c){if(y>0)y-=1;if(a!=-1){b=d.scrollTop;var e=d.clientHeight;if(c==0)if(b+e<a)c=1;else if(a<b)c=2;switch(c){case 1:d.scrollTop=a;break;case 2:d.scrollTop=a-(e-I());break;case 3:d.scrollTop=a-(e-I())/2;break}d.onscroll()}};var t=null;g.handleDragDrop=function(b,a,c,e,k){if(t){t.className=t.classNameOrig;t=null}if(b!="end"){var h=w(c);if(!h.selected&&h.drop)if(b=="drop")p.emit(g,{name:"dropEvent",eventObject:a,event:c},h.rowIdx,h.columnId,e,k);else{a.className="Wt-valid-drop";t=h.el;t.classNameOrig=
 t.className;t.className+=" Wt-drop-site"}else a.className=""}};this.onkeydown=function(b){var a=b||window.event;if(a.keyCode==9){f.cancelEvent(a);var c=w(a);if(c.el){b=c.el.parentNode;c=z(c.el);var e=z(b),k=b.parentNode.childNodes.length,h=b.childNodes.length;a=a.shiftKey;for(var i=false,j=c,m;;){for(;a?j>=0:j<h;j=a?j-1:j+1)for(m=j==c&&!i?a?e-1:e+1:a?k-1:0;a?m>=0:m<k;m=a?m-1:m+1){if(j==c&&m==e)return;b=b.parentNode.childNodes[m];var n=$(b.childNodes[j]).find(":input");if(n.size()>0){setTimeout(function(){n.focus();
 n.select()},0);return}}j=a?h-1:0;i=true}}}else if(a.keyCode>=37&&a.keyCode<=40){i=f.target(a);function o(u){return f.hasTag(u,"INPUT")&&u.type=="text"||f.hasTag(u,"TEXTAREA")}if(!f.hasTag(i,"SELECT")){c=w(a);if(c.el){b=c.el.parentNode;c=z(c.el);e=z(b);k=b.parentNode.childNodes.length;h=b.childNodes.length;switch(a.keyCode){case 39:if(o(i)){j=f.getSelectionRange(i);if(j.start!=i.value.length)return}e++;break;case 38:c--;break;case 37:if(o(i)){j=f.getSelectionRange(i);if(j.start!=0)return}e--;break;
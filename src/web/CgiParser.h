@@ -10,15 +10,84 @@
 #include <string>
 #include <map>
 #include <iostream>
+#include <fstream>
+#include <memory>
 #include <vector>
 
 #include <Wt/WDllDefs.h>
+#include <Wt/Http/Request.h>
 
 namespace Wt {
 
 class CgiParser;
 class WebRequest;
 
+/*
+ * Parses a multipart/form-data body incrementally, as it is received.
+ *
+ * Values are collected in parameters(), and file parts are written
+ * directly to their spool files (see files()). Only the end of a block
+ * that may be the start of a boundary is kept until the next block.
+ */
+class WT_API MultipartParser
+{
+public:
+  MultipartParser(const std::string& boundary);
+  ~MultipartParser();
+
+  /*
+   * Finds the boundary in a multipart/form-data content type.
+   */
+  static bool boundary(const std::string& contentType, std::string& result);
+
+  /*
+   * Parses the next block of the body.
+   *
+   * A spool file is only open while parsing a block, to not keep a
+   * file descriptor open for a slow client.
+   */
+  void parse(const char *begin, const char *end);
+
+  /*
+   * Returns whether the final boundary has been parsed.
+   */
+  bool done() const { return state_ == Done; }
+
+  Http::ParameterMap& parameters() { return parameters_; }
+  Http::UploadedFileMap& files() { return files_; }
+
+private:
+  struct Pattern;
+
+  enum State { Preamble, Delimiter, Head, Body, Done };
+
+  State state_;
+  std::unique_ptr<Pattern> boundary_;
+
+  // the end of the previous block, which may start a boundary
+  std::string carry_;
+
+  // the two characters after a boundary: "--" for the final boundary
+  std::string delimiter_;
+
+  std::string head_;
+
+  // the last two bytes of a body, which may be the CRLF before the boundary
+  std::string held_;
+
+  std::string name_, value_, spoolFileName_;
+  std::ofstream spool_;
+
+  Http::ParameterMap parameters_;
+  Http::UploadedFileMap files_;
+
+  void consume(const char *s, std::size_t length);
+  void consumeBody(const char *s, std::size_t length);
+  void write(const char *s, std::size_t length);
+  void matched();
+  void parseHead();
+};
+
 /*
  * Parses CGI in all its forms (get/post/file uploads).
  *
@@ -43,26 +112,12 @@ public:
 private:
   void readMultipartData(WebRequest& request, const std::string type,
 			 ::int64_t len);
-  bool parseBody(WebRequest& request, const std::string boundary);
-  bool parseHead(WebRequest& request);
-  ::int64_t maxFormData_, maxRequestSize_, left_;
-  std::ostream *spoolStream_;
-  WebRequest *request_;
-
-  std::string currentKey_;
-
-  void readUntilBoundary(WebRequest& request, const std::string boundary,
-			 int tossAtBoundary,
-			 std::string *resultString,
-			 std::ostream *resultFile);
-  void windBuffer(int offset);
-  int index(const std::string search);
+  void takeMultipartData(WebRequest& request, MultipartParser& parser);
+  ::int64_t maxFormData_, maxRequestSize_;
 
   enum {BUFSIZE = 8192};
-  enum {MAXBOUND = 100};
 
-  int buflen_;
-  char buf_[BUFSIZE + MAXBOUND];
+  char buf_[BUFSIZE];
 };
 
 }
@@ -191,6 +191,8 @@ public:
   int indicatorTimeout() const;
   int doubleClickTimeout() const;
   int serverPushTimeout() const;
+  ::int64_t softMemoryLimit() const; // -1 if not set
+  ::int64_t hardMemoryLimit() const; // -1 if not set
   std::string valgrindPath() const;
   ErrorReporting errorReporting() const;
   bool debug() const;
@@ -304,6 +306,8 @@ private:
   int		  indicatorTimeout_;
   int             doubleClickTimeout_;
   int             serverPushTimeout_;
+  ::int64_t       softMemoryLimit_;
+  ::int64_t       hardMemoryLimit_;
   std::string     valgrindPath_;
   ErrorReporting  errorReporting_;
   std::string     runDirectory_;
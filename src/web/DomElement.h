@@ -13,6 +13,7 @@
 
 #include "Wt/WWebWidget.h"
 #include "EscapeOStream.h"
+#include "FlatMap.h"
 
 namespace Wt {
 
@@ -109,7 +110,7 @@ public:
 
 #ifndef WT_TARGET_JAVA
   /*! \brief A map for property values */
-  typedef std::map<Wt::Property, std::string> PropertyMap;
+  typedef Impl::FlatMap<Wt::Property, std::string> PropertyMap;
 #else
   typedef std::treemap<Wt::Property, std::string> PropertyMap;
 #endif
@@ -132,6 +133,45 @@ public:
    */
   ~DomElement();
 
+#ifndef WT_TARGET_JAVA
+  /*! \brief An arena for the DOM elements of a render pass.
+   *
+   * While an arena exists, DOM elements that are created by the same
+   * thread are allocated from large blocks owned by the arena, rather
+   * than individually from the heap. The blocks are released when both
+   * the arena and all elements allocated from it have been deleted, and
+   * a few blocks are kept by the thread for the next arena.
+   *
+   * The renderer uses an arena for each response.
+   */
+  class WT_API Arena
+  {
+  public:
+    /*! \brief Creates an arena, and makes it current for this thread.
+     */
+    Arena();
+
+    /*! \brief Deletes the arena, and restores the previous arena.
+     */
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    struct Pool;
+
+  private:
+    Pool *pool_, *previous_;
+
+    static void release(Pool *pool);
+
+    friend class DomElement;
+  };
+
+  static void *operator new(std::size_t size);
+  static void operator delete(void *element, std::size_t size);
+#endif // WT_TARGET_JAVA
+
   /*! \brief set dom element custom tag name 
    */
   void setDomElementTagName(const std::string& name);
@@ -527,7 +567,7 @@ private:
       : jsCode(j), signalName(sn) { }
   };
 
-  typedef std::map<std::string, std::string> AttributeMap;
+  typedef Impl::FlatMap<std::string, std::string> AttributeMap;
   typedef std::set<std::string> AttributeSet;
   typedef std::map<const char *, EventHandler> EventHandlerMap;
 
@@ -9,6 +9,8 @@
 
 #include <Wt/WStringStream.h>
 
+#include <cstring>
+
 #ifndef WT_DBO_ESCAPEOSTREAM
 #define WT_ESCAPEOSTREAM_API WT_API
 #else // WT_DBO_ESCAPEOSTREAM
@@ -49,7 +51,7 @@ public:
     if (c_special_ == 0)
       stream_ << s;
     else
-      put(s, *this);
+      put(s, std::strlen(s), *this);
 
     return *this;
   }
@@ -78,8 +80,14 @@ private:
   std::string special_;
   const char *c_special_;
 
+  /*
+   * For each byte value, 1 + the index of its entry in mixed_, or 0
+   * if it does not need escaping.
+   */
+  unsigned char index_[256];
+
   void mixRules();
-  void put(const char *s, const EscapeOStream& rules);
+  void put(const char *s, std::size_t length, const EscapeOStream& rules);
 
   void sAppend(char c);
   void sAppend(const char *s, int length);
@@ -0,0 +1,94 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2008 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_FLAT_MAP_H_
+#define WT_FLAT_MAP_H_
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace Wt {
+  namespace Impl {
+
+/*
+ * A map stored as a sorted vector of (key, value) pairs.
+ *
+ * This implements the subset of the std::map interface that is used
+ * for the (small) maps of a DomElement, using a single allocation
+ * instead of one allocation per entry. Iteration is in key order, as
+ * with std::map. Inserting or erasing an entry invalidates iterators.
+ */
+template <typename K, typename V>
+class FlatMap
+{
+public:
+  typedef K key_type;
+  typedef V mapped_type;
+  typedef std::pair<K, V> value_type;
+  typedef typename std::vector<value_type>::size_type size_type;
+  typedef typename std::vector<value_type>::iterator iterator;
+  typedef typename std::vector<value_type>::const_iterator const_iterator;
+
+  iterator begin() { return values_.begin(); }
+  iterator end() { return values_.end(); }
+  const_iterator begin() const { return values_.begin(); }
+  const_iterator end() const { return values_.end(); }
+
+  bool empty() const { return values_.empty(); }
+  size_type size() const { return values_.size(); }
+  void clear() { values_.clear(); }
+
+  iterator find(const K& key) {
+    iterator i = lowerBound(key);
+    return (i != values_.end() && !(key < i->first)) ? i : values_.end();
+  }
+
+  const_iterator find(const K& key) const {
+    const_iterator i = lowerBound(key);
+    return (i != values_.end() && !(key < i->first)) ? i : values_.end();
+  }
+
+  V& operator[](const K& key) {
+    iterator i = lowerBound(key);
+    if (i == values_.end() || key < i->first)
+      i = values_.insert(i, value_type(key, V()));
+    return i->second;
+  }
+
+  iterator erase(iterator i) { return values_.erase(i); }
+
+  size_type erase(const K& key) {
+    iterator i = find(key);
+    if (i != values_.end()) {
+      values_.erase(i);
+      return 1;
+    } else
+      return 0;
+  }
+
+private:
+  std::vector<value_type> values_;
+
+  iterator lowerBound(const K& key) {
+    return std::lower_bound(values_.begin(), values_.end(), key, KeyLess());
+  }
+
+  const_iterator lowerBound(const K& key) const {
+    return std::lower_bound(values_.begin(), values_.end(), key, KeyLess());
+  }
+
+  struct KeyLess {
+    bool operator()(const value_type& v, const K& key) const {
+      return v.first < key;
+    }
+  };
+};
+
+  }
+}
+
+#endif // WT_FLAT_MAP_H_
@@ -0,0 +1,63 @@
+// This may look like C code, but it's really -*- C++ -*-
+/*
+ * Copyright (C) 2008 Emweb bv, Herent, Belgium.
+ *
+ * See the LICENSE file for terms of use.
+ */
+#ifndef WT_MEMORY_ACCOUNT_H_
+#define WT_MEMORY_ACCOUNT_H_
+
+#include <atomic>
+#include <cstddef>
+
+#include "Wt/WDllDefs.h"
+
+namespace Wt {
+
+/*
+ * Accounts for the heap memory that is allocated on behalf of a
+ * session.
+ *
+ * When Wt is built with WT_MEMORY_ACCOUNTING, the global operator new
+ * and delete are replaced: every allocation made by a thread while an
+ * account is attached to it (see attach()) is charged to that account,
+ * and is credited again when it is deleted, by whatever thread.
+ *
+ * An account stays alive as long as it has an owner (see release()),
+ * or memory that is charged to it.
+ *
+ * Without WT_MEMORY_ACCOUNTING, usage() returns -1.
+ */
+class WT_API MemoryAccount
+{
+public:
+  // creates an account, owned by the caller
+  static MemoryAccount *create();
+
+  // releases the owner's reference
+  void release();
+
+  // returns the number of bytes charged, or -1 if not available
+  long long usage() const;
+
+  // attaches an account to the current thread, returns the previous one
+  static MemoryAccount *attach(MemoryAccount *account);
+
+  // returns whether memory accounting is available
+  static bool enabled();
+
+  void charge(std::size_t size);
+  void credit(std::size_t size);
+
+private:
+  std::atomic<long long> bytes_;
+  std::atomic<long> references_;
+
+  MemoryAccount();
+  MemoryAccount(const MemoryAccount&) = delete;
+  MemoryAccount& operator=(const MemoryAccount&) = delete;
+};
+
+}
+
+#endif // WT_MEMORY_ACCOUNT_H_
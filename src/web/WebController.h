@@ -7,6 +7,8 @@
 #ifndef WT_WEB_CONTROLLER_H_
 #define WT_WEB_CONTROLLER_H_
 
+#include <atomic>
+#include <queue>
 #include <string>
 #include <vector>
 #include <set>
@@ -18,6 +20,7 @@
 
 #include "EntryPoint.h"
 #include "SocketNotifier.h"
+#include "TimeUtil.h"
 
 #if defined(WT_THREADED) && !defined(WT_TARGET_JAVA)
 #include <thread>
@@ -129,7 +132,9 @@ public:
 #endif // WT_CNOR
 
   std::vector<std::string> sessions();
+  long long sessionMemoryUsage(const std::string& sessionId);
   bool expireSessions();
+  void expireTimeChanged(WebSession *session);
   void start();
   void shutdown();
 
@@ -155,11 +160,12 @@ public:
 private:
   Configuration& conf_;
   std::string singleSessionId_;
+  const bool singleSession_;
   bool autoExpire_;
-  int plainHtmlSessions_, ajaxSessions_;
-  volatile int zombieSessions_;
+  std::atomic<int> plainHtmlSessions_, ajaxSessions_;
+  std::atomic<int> zombieSessions_;
   std::string redirectSecret_;
-  bool running_;
+  std::atomic<bool> running_;
 
 #ifdef WT_THREADED
   std::mutex uploadProgressUrlsMutex_;
@@ -167,11 +173,76 @@ private:
   std::set<std::string> uploadProgressUrls_;
 
   typedef std::map<std::string, std::shared_ptr<WebSession> > SessionMap;
-  SessionMap sessions_;
 
+  /*
+   * Sessions are distributed over a number of shards, based on a hash
+   * of the session id, each protected by its own mutex.
+   */
+  struct SessionShard {
 #ifdef WT_THREADED
-  // mutex to protect access to the sessions map and plain/ajax session
-  // counts
+    std::mutex mutex;
+#endif // WT_THREADED
+    SessionMap sessions;
+  };
+
+  static const int SESSION_SHARD_COUNT = 64;
+
+  SessionShard sessionShards_[SESSION_SHARD_COUNT];
+  std::atomic<int> sessionCount_;
+
+  SessionShard& sessionShard(const std::string& sessionId);
+  std::shared_ptr<WebSession> findSession(const std::string& sessionId);
+  void insertSession(const std::string& sessionId,
+		     const std::shared_ptr<WebSession>& session);
+
+  // with the shard's mutex held
+  std::shared_ptr<WebSession> findSession(SessionShard& shard,
+					  const std::string& sessionId);
+  void insertSession(SessionShard& shard, const std::string& sessionId,
+		     const std::shared_ptr<WebSession>& session);
+
+  /*
+   * Min-heap of session expiry times. There is one entry for every
+   * session in the shards. An entry that is due is checked against the
+   * current expireTime() of the session, and rescheduled if the session
+   * has been active since: expireSessions() is O(expired) rather than
+   * O(sessions).
+   *
+   * When the expire time of a session moves before its entry, a new
+   * entry is added, and the old one is dropped when it becomes due.
+   */
+  struct ExpiryEntry {
+    ExpiryEntry(const Time& anExpireTime, const std::string& aSessionId,
+		const WebSession *aSession)
+      : expireTime(anExpireTime),
+	sessionId(aSessionId),
+	session(aSession)
+    { }
+
+    Time expireTime;
+    std::string sessionId;
+    const WebSession *session; // only used for comparison
+  };
+
+  struct ExpiryLater {
+    bool operator()(const ExpiryEntry& a, const ExpiryEntry& b) const {
+      return a.expireTime - b.expireTime > 0;
+    }
+  };
+
+  std::priority_queue<ExpiryEntry, std::vector<ExpiryEntry>, ExpiryLater>
+    expiryQueue_;
+
+  void scheduleExpiry(const std::string& sessionId, WebSession *session,
+		      const Time& expireTime);
+
+#ifdef WT_THREADED
+  // mutex to protect access to expiryQueue_ and the scheduled expiry
+  // time of the sessions
+  std::mutex expiryMutex_;
+
+  // mutex to protect singleSessionId_ and to serialize session creation
+  // in a dedicated session process
   std::recursive_mutex mutex_;
 
   SocketNotifier socketNotifier_;
@@ -40,6 +40,14 @@ public:
 
   WebRenderer(WebSession& session);
 
+#ifndef WT_TARGET_JAVA
+  /*
+   * Serves the Wt library for a request=library request, which does
+   * not need a session.
+   */
+  static void serveLibrary(WebResponse& response);
+#endif // WT_TARGET_JAVA
+
   void setTwoPhaseThreshold(int bytes);
 
   bool visibleOnly() const { return visibleOnly_; }
@@ -134,6 +142,9 @@ private:
 
   void serveJavaScriptUpdate(WebResponse& response);
   void serveMainscript(WebResponse& response);
+#ifndef WT_TARGET_JAVA
+  std::string libraryUrl() const;
+#endif // WT_TARGET_JAVA
   void serveBootstrap(WebResponse& request);
   void serveMainpage(WebResponse& response);
   void serveMainAjax(WStringStream& out);
@@ -21,7 +21,9 @@ namespace Wt {
 
 class Configuration;
 class EntryPoint;
+class MultipartParser;
 class WSslInfo;
+class WStringStream;
 
 /*
  * A single, raw, HTTP request/response, which conveys all of the http-related
@@ -102,6 +104,14 @@ public:
 
   WT_BOSTREAM& bout() { return out(); }
 
+  /*
+   * Appends the contents of a stream to the response, leaving the
+   * stream empty. This is like writing the stream to out(), but a
+   * connector that sends its output as a list of buffers takes over
+   * the stream's buffers instead of copying them.
+   */
+  virtual void spool(WStringStream& stream);
+
   /*
    * (Not used)
    */
@@ -206,6 +216,12 @@ protected:
   virtual ~WebRequest();
   void reset();
 
+  /*
+   * Returns the multipart/form-data body if it was already parsed
+   * while it was received, or nullptr (see CgiParser).
+   */
+  virtual MultipartParser *parsedMultipart() { return nullptr; }
+
 #ifndef WT_CNOR
   struct AsyncEmulation;
   AsyncEmulation *async_;
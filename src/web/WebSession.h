@@ -25,6 +25,7 @@
 #include <boost/thread.hpp>
 #endif // WT_TARGET_JAVA
 
+#include "MemoryAccount.h"
 #include "TimeUtil.h"
 #include "WebRenderer.h"
 #include "WebRequest.h"
@@ -125,6 +126,14 @@ public:
   State state() const { return state_; }
   void kill();
 
+#ifndef WT_TARGET_JAVA
+  /*
+   * Returns the heap memory held by this session (in bytes), or -1 if
+   * Wt was built without memory accounting.
+   */
+  long long memoryUsage() const { return memoryAccount_->usage(); }
+#endif // WT_TARGET_JAVA
+
   bool progressiveBoot() const { return progressiveBoot_; }
 
   /*
@@ -281,8 +290,22 @@ private:
 #endif
 
   void checkTimers();
+  void checkMemoryUsage();
   void hibernate();
 
+#ifndef WT_TARGET_JAVA
+  struct MemoryAccountReleaser {
+    void operator()(MemoryAccount *account) const { account->release(); }
+  };
+
+  /*
+   * Declared first so that it is released only after all other
+   * members have been destroyed.
+   */
+  std::unique_ptr<MemoryAccount, MemoryAccountReleaser> memoryAccount_;
+  bool memoryLimitWarned_;
+#endif // WT_TARGET_JAVA
+
 #ifdef WT_BOOST_THREADS
   std::mutex mutex_;
   std::mutex eventQueueMutex_;
@@ -316,6 +339,7 @@ private:
 
 #ifndef WT_TARGET_JAVA
   Time             expire_;
+  Time             expiryScheduled_; // protected by the controller
 #endif
 
 #ifdef WT_BOOST_THREADS
@@ -376,6 +400,7 @@ private:
   void processQueuedEvents(WebSession::Handler& handler);
   std::shared_ptr<ApplicationEvent> popQueuedEvent();
 
+  friend class WebController;
   friend class WebSocketMessage;
   friend class WebRenderer;
   friend class WebSocketSupport;
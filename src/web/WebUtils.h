@@ -281,6 +281,10 @@ extern std::string dataUrlDecode(const std::string& url,
 
 #ifndef WT_TARGET_JAVA
 extern void inplaceUrlDecode(std::string& s);
+
+// Compresses 'in' to a gzip stream in 'out', returns false when that
+// fails or when libwt is built without zlib
+extern WT_API bool gzipCompress(const std::string& in, std::string& out);
 #endif
 
 extern std::string EncodeHttpHeaderField(const std::string &fieldname,
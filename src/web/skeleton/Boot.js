@@ -317,8 +317,10 @@ _$_$ifnot_SPLIT_SCRIPT_$_();
                null);
 _$_$endif_$_();
 _$_$if_SPLIT_SCRIPT_$_();
-    /* Ideally, we should be able to omit the sessionid too */
-    loadScript(selfUrl + allInfo + '&request=script&skeleton=true',
+    /* The library does not depend on the session, when its URL is known */
+    var libraryUrl = _$_LIBRARY_URL_$_;
+    loadScript(libraryUrl
+               ? libraryUrl : selfUrl + allInfo + '&request=script&skeleton=true',
                function() {
                  loadScript(selfUrl + allInfo
                             + '&request=script&rand=' + rand(), null);
@@ -9,4 +9,4 @@ function u(c,q){var j,f,n,y,z=false;f=m();j=0;for(y=f.length;j<y;j++){n=f[j].spl
 b.indexOf("?");if(e!=-1)b=b.substr(0,e);e=navigator.userAgent.toLowerCase();if(e.indexOf("gecko")==-1||e.indexOf("webkit")!=-1)b=unescape(b);e="";if(screen.deviceXDPI!=screen.logicalXDPI)e="&scale="+screen.deviceXDPI/screen.logicalXDPI;_$_$if_WEBGL_DETECT_$_();if(window.WebGLRenderingContext){var v=document.createElement("canvas"),s=null;try{s=v.getContext("webgl",{antialias:true})}catch(C){}if(s==null)try{s=v.getContext("experimental-webgl")}catch(D){}if(s!=null)e+="&webGL=true"}_$_$endif_$_();e+=
 "&scrW="+screen.width+"&scrH="+screen.height;var w=_$_SELF_URL_$_+"&sid="+_$_SCRIPT_ID_$_;s=(v=!!(window.history&&window.history.pushState))?"&htmlHistory=true":"";var A=(new Date).getTimezoneOffset();e+="&tz="+-A;if(typeof Intl==="object"&&typeof Intl.DateTimeFormat==="function"&&typeof Intl.DateTimeFormat().resolvedOptions==="function"&&Intl.DateTimeFormat().resolvedOptions().timeZone)e+="&tzS="+encodeURIComponent(Intl.DateTimeFormat().resolvedOptions().timeZone);if(k=!k||!o)if(g("wtd")==="_$_SESSION_ID_$_")k=
 false;if(k)if(v)r(u("wtd","_$_SESSION_ID_$_"));else{i=b.length>1&&b.charAt(0)=="/"?b:_$_INTERNAL_PATH_$_;if(i.length>0)w+="#"+i;r(w)}else if(o){o=_$_AJAX_CANONICAL_URL_$_;k="";if(!v&&o.length>1){_$_$if_HYBRID_$_();i="WtInternalPath="+escape(_$_INTERNAL_PATH_$_)+";path=/;expires="+d.toGMTString();p.cookie=i;_$_$endif_$_();if(o.charAt(0)=="#")o="../"+o;r(o)}else{if(b.length>1&&b.charAt(0)=="/"){k="&_="+encodeURIComponent(b);_$_$if_HYBRID_$_();b!=_$_INTERNAL_PATH_$_&&setTimeout(t,10);_$_$endif_$_()}_$_$if_PROGRESS_$_();
-setupDelayClick();_$_$endif_$_();var x=k+e+s+i;_$_$ifnot_SPLIT_SCRIPT_$_();loadScript(w+x+"&request=script&rand="+l(),null);_$_$endif_$_();_$_$if_SPLIT_SCRIPT_$_();loadScript(w+x+"&request=script&skeleton=true",function(){loadScript(w+x+"&request=script&rand="+l(),null)});_$_$endif_$_()}}}setTimeout(a,0)})();
+setupDelayClick();_$_$endif_$_();var x=k+e+s+i;_$_$ifnot_SPLIT_SCRIPT_$_();loadScript(w+x+"&request=script&rand="+l(),null);_$_$endif_$_();_$_$if_SPLIT_SCRIPT_$_();var L=_$_LIBRARY_URL_$_;loadScript(L?L:w+x+"&request=script&skeleton=true",function(){loadScript(w+x+"&request=script&rand="+l(),null)});_$_$endif_$_()}}}setTimeout(a,0)})();